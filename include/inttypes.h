@@ -0,0 +1,185 @@
+#ifndef _INTTYPES_H
+#define _INTTYPES_H 1
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct {
+    intmax_t quot;
+    intmax_t rem;
+} imaxdiv_t;
+
+/* int_fast16_t and int_fast32_t are either int or long depending on the compiler */
+#if __INT_FAST16_WIDTH__ == 64
+#define __PRIFAST16 "l"
+#else
+#define __PRIFAST16
+#endif
+
+#if __INT_FAST32_WIDTH__ == 64
+#define __PRIFAST32 "l"
+#else
+#define __PRIFAST32
+#endif
+
+#define PRId8 "d"
+#define PRId16 "d"
+#define PRId32 "d"
+#define PRId64 "ld"
+#define PRIi8 "i"
+#define PRIi16 "i"
+#define PRIi32 "i"
+#define PRIi64 "li"
+#define PRIo8 "o"
+#define PRIo16 "o"
+#define PRIo32 "o"
+#define PRIo64 "lo"
+#define PRIu8 "u"
+#define PRIu16 "u"
+#define PRIu32 "u"
+#define PRIu64 "lu"
+#define PRIx8 "x"
+#define PRIx16 "x"
+#define PRIx32 "x"
+#define PRIx64 "lx"
+#define PRIX8 "X"
+#define PRIX16 "X"
+#define PRIX32 "X"
+#define PRIX64 "lX"
+
+#define PRIdLEAST8 "d"
+#define PRIdLEAST16 "d"
+#define PRIdLEAST32 "d"
+#define PRIdLEAST64 "ld"
+#define PRIiLEAST8 "i"
+#define PRIiLEAST16 "i"
+#define PRIiLEAST32 "i"
+#define PRIiLEAST64 "li"
+#define PRIoLEAST8 "o"
+#define PRIoLEAST16 "o"
+#define PRIoLEAST32 "o"
+#define PRIoLEAST64 "lo"
+#define PRIuLEAST8 "u"
+#define PRIuLEAST16 "u"
+#define PRIuLEAST32 "u"
+#define PRIuLEAST64 "lu"
+#define PRIxLEAST8 "x"
+#define PRIxLEAST16 "x"
+#define PRIxLEAST32 "x"
+#define PRIxLEAST64 "lx"
+#define PRIXLEAST8 "X"
+#define PRIXLEAST16 "X"
+#define PRIXLEAST32 "X"
+#define PRIXLEAST64 "lX"
+
+#define PRIdFAST8 "d"
+#define PRIdFAST16 __PRIFAST16 "d"
+#define PRIdFAST32 __PRIFAST32 "d"
+#define PRIdFAST64 "ld"
+#define PRIiFAST8 "i"
+#define PRIiFAST16 __PRIFAST16 "i"
+#define PRIiFAST32 __PRIFAST32 "i"
+#define PRIiFAST64 "li"
+#define PRIoFAST8 "o"
+#define PRIoFAST16 __PRIFAST16 "o"
+#define PRIoFAST32 __PRIFAST32 "o"
+#define PRIoFAST64 "lo"
+#define PRIuFAST8 "u"
+#define PRIuFAST16 __PRIFAST16 "u"
+#define PRIuFAST32 __PRIFAST32 "u"
+#define PRIuFAST64 "lu"
+#define PRIxFAST8 "x"
+#define PRIxFAST16 __PRIFAST16 "x"
+#define PRIxFAST32 __PRIFAST32 "x"
+#define PRIxFAST64 "lx"
+#define PRIXFAST8 "X"
+#define PRIXFAST16 __PRIFAST16 "X"
+#define PRIXFAST32 __PRIFAST32 "X"
+#define PRIXFAST64 "lX"
+
+#define PRIdMAX "ld"
+#define PRIiMAX "li"
+#define PRIoMAX "lo"
+#define PRIuMAX "lu"
+#define PRIxMAX "lx"
+#define PRIXMAX "lX"
+#define PRIdPTR "ld"
+#define PRIiPTR "li"
+#define PRIoPTR "lo"
+#define PRIuPTR "lu"
+#define PRIxPTR "lx"
+#define PRIXPTR "lX"
+
+/* scanf has no length modifier for 8-bit integers, so there are no SCN*8 macros */
+#define SCNd16 "hd"
+#define SCNd32 "d"
+#define SCNd64 "ld"
+#define SCNi16 "hi"
+#define SCNi32 "i"
+#define SCNi64 "li"
+#define SCNo16 "ho"
+#define SCNo32 "o"
+#define SCNo64 "lo"
+#define SCNu16 "hu"
+#define SCNu32 "u"
+#define SCNu64 "lu"
+#define SCNx16 "hx"
+#define SCNx32 "x"
+#define SCNx64 "lx"
+
+#define SCNdLEAST16 "hd"
+#define SCNdLEAST32 "d"
+#define SCNdLEAST64 "ld"
+#define SCNiLEAST16 "hi"
+#define SCNiLEAST32 "i"
+#define SCNiLEAST64 "li"
+#define SCNoLEAST16 "ho"
+#define SCNoLEAST32 "o"
+#define SCNoLEAST64 "lo"
+#define SCNuLEAST16 "hu"
+#define SCNuLEAST32 "u"
+#define SCNuLEAST64 "lu"
+#define SCNxLEAST16 "hx"
+#define SCNxLEAST32 "x"
+#define SCNxLEAST64 "lx"
+
+#define SCNdFAST16 __PRIFAST16 "d"
+#define SCNdFAST32 __PRIFAST32 "d"
+#define SCNdFAST64 "ld"
+#define SCNiFAST16 __PRIFAST16 "i"
+#define SCNiFAST32 __PRIFAST32 "i"
+#define SCNiFAST64 "li"
+#define SCNoFAST16 __PRIFAST16 "o"
+#define SCNoFAST32 __PRIFAST32 "o"
+#define SCNoFAST64 "lo"
+#define SCNuFAST16 __PRIFAST16 "u"
+#define SCNuFAST32 __PRIFAST32 "u"
+#define SCNuFAST64 "lu"
+#define SCNxFAST16 __PRIFAST16 "x"
+#define SCNxFAST32 __PRIFAST32 "x"
+#define SCNxFAST64 "lx"
+
+#define SCNdMAX "ld"
+#define SCNiMAX "li"
+#define SCNoMAX "lo"
+#define SCNuMAX "lu"
+#define SCNxMAX "lx"
+#define SCNdPTR "ld"
+#define SCNiPTR "li"
+#define SCNoPTR "lo"
+#define SCNuPTR "lu"
+#define SCNxPTR "lx"
+
+intmax_t imaxabs(intmax_t __j);
+imaxdiv_t imaxdiv(intmax_t __numer, intmax_t __denom);
+intmax_t strtoimax(const char *__restrict __nptr, char **__restrict __endptr, int __base);
+uintmax_t strtoumax(const char *__restrict __nptr, char **__restrict __endptr, int __base);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* _INTTYPES_H */
@@ -16,11 +16,37 @@ typedef struct {
     unsigned long __offset;
 } fpos_t;
 
+typedef long ssize_t;
+typedef long off_t;
+
+typedef ssize_t cookie_read_function_t(void *__cookie, char *__buf, size_t __size);
+typedef ssize_t cookie_write_function_t(void *__cookie, const char *__buf, size_t __size);
+typedef int cookie_seek_function_t(void *__cookie, off_t *__offset, int __whence);
+typedef int cookie_close_function_t(void *__cookie);
+
 typedef struct {
+    cookie_read_function_t *read;
+    cookie_write_function_t *write;
+    cookie_seek_function_t *seek;
+    cookie_close_function_t *close;
+} cookie_io_functions_t;
+
+typedef struct __FILE {
+    unsigned char *__rpos; /* next buffered byte to be read, or NULL if the stream isn't reading */
+    unsigned char *__rend; /* end of the buffered input */
+    unsigned char *__wpos; /* next free byte in the output buffer, or NULL if the stream isn't writing */
+    unsigned char *__wend; /* end of the space available for output */
+    unsigned char *__buf;  /* start of the buffer, preceded by 16 bytes of space for ungetc */
+    size_t __buf_size;
+    long __offset;                    /* position of the backend, or -1 if it isn't known */
+    const struct __stream_ops *__ops; /* backend the buffered data is transferred to and from */
+    void *__cookie;                   /* backend-specific state */
     int __fd;
     int __flags;
-    unsigned char __push_buffer[16];
-    size_t __push_count;
+    int __mode;
+    unsigned char __small_buf[17]; /* ungetc space and single-byte buffer used by unbuffered streams */
+    struct __FILE *__prev;         /* links in the list of open streams, or of free FILE objects */
+    struct __FILE *__next;
 } FILE;
 
 #define _IOFBF 0
@@ -59,6 +85,8 @@ int fclose(FILE *__stream);
 int fflush(FILE *__stream);
 FILE *fopen(const char *__restrict __filename, const char *__restrict __mode);
 FILE *freopen(const char *__restrict __filename, const char *__restrict __mode, FILE *__restrict __stream);
+FILE *fmemopen(void *__restrict __buf, size_t __size, const char *__restrict __mode);
+FILE *open_memstream(char **__ptr, size_t *__sizeloc);
 void setbuf(FILE *__restrict __stream, char *__restrict __buf);
 int setvbuf(FILE *__restrict __stream, char *__restrict __buf, int __mode, size_t __size);
 __attribute__((__format__(__printf__, 2, 3))) int fprintf(
@@ -74,6 +102,12 @@ __attribute__((__format__(__scanf__, 2, 3))) int fscanf(
 __attribute__((__format__(__printf__, 1, 2))) int printf(const char *__restrict __format, ...);
 __attribute__((__format__(__scanf__, 1, 2))) int scanf(const char *__restrict __format, ...);
 __attribute__((__format__(__printf__, 2, 3))) int sprintf(char *__restrict __s, const char *__restrict __format, ...);
+__attribute__((__format__(__printf__, 3, 4))) int snprintf(
+        char *__restrict __s,
+        size_t __n,
+        const char *__restrict __format,
+        ...
+);
 __attribute__((__format__(__scanf__, 2, 3))) int sscanf(
         const char *__restrict __s,
         const char *__restrict __format,
@@ -90,6 +124,12 @@ __attribute__((__format__(__printf__, 2, 0))) int vsprintf(
         const char *__restrict __format,
         __gnuc_va_list __arg
 );
+__attribute__((__format__(__printf__, 3, 0))) int vsnprintf(
+        char *__restrict __s,
+        size_t __n,
+        const char *__restrict __format,
+        __gnuc_va_list __arg
+);
 int fgetc(FILE *__stream);
 char *fgets(char *__restrict __s, int __n, FILE *__restrict __stream);
 int fputc(int __c, FILE *__stream);
@@ -113,6 +153,85 @@ int feof(FILE *__stream);
 int ferror(FILE *__stream);
 void perror(const char *__s);
 
+/* POSIX extensions */
+ssize_t getdelim(char **__restrict __lineptr, size_t *__restrict __n, int __delim, FILE *__restrict __stream);
+ssize_t getline(char **__restrict __lineptr, size_t *__restrict __n, FILE *__restrict __stream);
+__attribute__((__format__(__printf__, 2, 3))) int dprintf(int __fd, const char *__restrict __format, ...);
+__attribute__((__format__(__printf__, 2, 0))) int vdprintf(
+        int __fd,
+        const char *__restrict __format,
+        __gnuc_va_list __arg
+);
+
+/* GNU and BSD extensions */
+__attribute__((__format__(__printf__, 2, 3))) int asprintf(char **__restrict __strp, const char *__restrict __format, ...);
+__attribute__((__format__(__printf__, 2, 0))) int vasprintf(
+        char **__restrict __strp,
+        const char *__restrict __format,
+        __gnuc_va_list __arg
+);
+FILE *fopencookie(void *__restrict __cookie, const char *__restrict __mode, cookie_io_functions_t __io_funcs);
+FILE *funopen(
+        const void *__cookie,
+        int (*__readfn)(void *, char *, int),
+        int (*__writefn)(void *, const char *, int),
+        off_t (*__seekfn)(void *, off_t, int),
+        int (*__closefn)(void *)
+);
+int getc_unlocked(FILE *__stream);
+int getchar_unlocked(void);
+int putc_unlocked(int __c, FILE *__stream);
+int putchar_unlocked(int __c);
+size_t fread_unlocked(void *__restrict __ptr, size_t __size, size_t __nmemb, FILE *__restrict __stream);
+size_t fwrite_unlocked(const void *__restrict __ptr, size_t __size, size_t __nmemb, FILE *__restrict __stream);
+
+/* Extensions */
+
+/* A format string that was parsed once by printf_compile, so that the *_compiled functions don't have to parse it
+   again on every call. It doesn't reference the original string, and it is released with free. */
+typedef struct __printf_format printf_format_t;
+
+printf_format_t *printf_compile(const char *__format);
+int fprintf_compiled(FILE *__restrict __stream, const printf_format_t *__restrict __format, ...);
+int snprintf_compiled(char *__restrict __s, size_t __n, const printf_format_t *__restrict __format, ...);
+int vfprintf_compiled(FILE *__restrict __stream, const printf_format_t *__restrict __format, __gnuc_va_list __arg);
+int vsnprintf_compiled(
+        char *__restrict __s,
+        size_t __n,
+        const printf_format_t *__restrict __format,
+        __gnuc_va_list __arg
+);
+
+/* Slow paths of the inline getc and putc, called when the buffer is empty or full. */
+int __uflow(FILE *__stream);
+int __overflow(FILE *__stream, int __c);
+
+static __inline__ int __getc_inline(FILE *__stream) {
+    if (__stream->__rpos != __stream->__rend) return *__stream->__rpos++;
+    return __uflow(__stream);
+}
+
+static __inline__ int __putc_inline(int __c, FILE *__stream) {
+    unsigned char __v = __c;
+
+    if (__stream->__wpos != __stream->__wend && (__v != '\n' || __stream->__mode != _IOLBF)) {
+        return *__stream->__wpos++ = __v;
+    }
+
+    return __overflow(__stream, __c);
+}
+
+#ifndef __cplusplus
+#define getc(__stream) __getc_inline(__stream)
+#define getchar() __getc_inline(stdin)
+#define putc(__c, __stream) __putc_inline(__c, __stream)
+#define putchar(__c) __putc_inline(__c, stdout)
+#define getc_unlocked(__stream) __getc_inline(__stream)
+#define getchar_unlocked() __getc_inline(stdin)
+#define putc_unlocked(__c, __stream) __putc_inline(__c, __stream)
+#define putchar_unlocked(__c) __putc_inline(__c, stdout)
+#endif
+
 #ifdef __cplusplus
 };
 #endif
@@ -0,0 +1,24 @@
+#ifndef _STDIO_EXT_H
+#define _STDIO_EXT_H 1
+
+#include <stdio.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Returns the number of bytes of buffered input. */
+size_t __freadahead(FILE *__stream);
+
+/* Returns a view of the buffered input, refilling the buffer first if it's empty. For streams opened with the "m"
+   mode flag, this is the entire rest of the file. Returns NULL at end of file or on error. */
+const char *__freadptr(FILE *__stream, size_t *__size);
+
+/* Consumes __size bytes of the view returned by __freadptr. */
+void __freadptrinc(FILE *__stream, size_t __size);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* _STDIO_EXT_H */
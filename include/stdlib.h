@@ -28,9 +28,17 @@ typedef struct {
 double atof(const char *__nptr);
 int atoi(const char *__nptr);
 long atol(const char *__nptr);
+long long atoll(const char *__nptr);
 double strtod(const char *__restrict __nptr, char **__restrict __endptr);
+float strtof(const char *__restrict __nptr, char **__restrict __endptr);
+long double strtold(const char *__restrict __nptr, char **__restrict __endptr);
 long strtol(const char *__restrict __nptr, char **__restrict __endptr, int __base);
+long long strtoll(const char *__restrict __nptr, char **__restrict __endptr, int __base);
 unsigned long strtoul(const char *__restrict __nptr, char **__restrict __endptr, int __base);
+unsigned long long strtoull(const char *__restrict __nptr, char **__restrict __endptr, int __base);
+int strfromd(char *__restrict __str, size_t __n, const char *__restrict __format, double __fp);
+int strfromf(char *__restrict __str, size_t __n, const char *__restrict __format, float __fp);
+int strfroml(char *__restrict __str, size_t __n, const char *__restrict __format, long double __fp);
 int rand(void);
 void srand(unsigned __seed);
 void *calloc(size_t __nmemb, size_t __size);
@@ -60,6 +68,19 @@ int wctomb(char *__s, wchar_t __wchar);
 size_t mbstowcs(wchar_t *__restrict __pwcs, const char *__restrict __s, size_t __n);
 size_t wcstombs(char *__restrict __s, const wchar_t *__restrict __pwcs, size_t __n);
 
+/* Extensions */
+
+/* Write the digits of __value in the given base (2 to 36) to the range [__first, __last), without a terminator.
+   Return a pointer past the last character written, or NULL if the range is too small or the base is invalid. */
+char *ltochars(char *__first, char *__last, long __value, int __base);
+char *ultochars(char *__first, char *__last, unsigned long __value, int __base);
+
+/* Write the shortest representation of __value that reads back as the same value to the range [__first, __last),
+   without a terminator. Like C++'s std::to_chars, this uses fixed or scientific notation, whichever is shorter.
+   Return a pointer past the last character written, or NULL if the range is too small. */
+char *dtochars(char *__first, char *__last, double __value);
+char *ftochars(char *__first, char *__last, float __value);
+
 #ifdef __cplusplus
 };
 #endif
@@ -32,6 +32,35 @@ void *memset(void *__s, int __c, size_t __n);
 char *strerror(int __errnum);
 size_t strlen(const char *__s);
 
+/* POSIX and BSD/GNU extensions */
+void *mempcpy(void *__restrict __s1, const void *__restrict __s2, size_t __n);
+void *memccpy(void *__restrict __s1, const void *__restrict __s2, int __c, size_t __n);
+void *memrchr(const void *__s, int __c, size_t __n);
+char *strcasestr(const char *__s1, const char *__s2);
+char *stpcpy(char *__restrict __s1, const char *__restrict __s2);
+char *stpncpy(char *__restrict __s1, const char *__restrict __s2, size_t __n);
+size_t strlcpy(char *__restrict __s1, const char *__restrict __s2, size_t __n);
+size_t strlcat(char *__restrict __s1, const char *__restrict __s2, size_t __n);
+size_t strnlen(const char *__s, size_t __n);
+char *strdup(const char *__s);
+char *strndup(const char *__s, size_t __n);
+
+/* Calls with a small constant size are expanded inline, even when the compiler doesn't treat these functions as
+   builtins (e.g. with -fno-builtin). Everything else still goes to the out-of-line versions. Define
+   __NO_STRING_INLINES to disable this. */
+#if defined(__GNUC__) && defined(__OPTIMIZE__) && !defined(__cplusplus) && !defined(__NO_STRING_INLINES)
+#define __STRING_INLINE_MAX 64
+#define __string_inline_size(__n) (__builtin_constant_p(__n) && (__n) <= __STRING_INLINE_MAX)
+
+#define memcpy(__s1, __s2, __n)                                                                                        \
+    (__string_inline_size(__n) ? __builtin_memcpy(__s1, __s2, __n) : (memcpy)(__s1, __s2, __n))
+#define memmove(__s1, __s2, __n)                                                                                       \
+    (__string_inline_size(__n) ? __builtin_memmove(__s1, __s2, __n) : (memmove)(__s1, __s2, __n))
+#define memset(__s, __c, __n) (__string_inline_size(__n) ? __builtin_memset(__s, __c, __n) : (memset)(__s, __c, __n))
+#define memcmp(__s1, __s2, __n)                                                                                        \
+    (__string_inline_size(__n) ? __builtin_memcmp(__s1, __s2, __n) : (memcmp)(__s1, __s2, __n))
+#endif
+
 #ifdef __cplusplus
 };
 #endif
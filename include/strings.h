@@ -0,0 +1,21 @@
+#ifndef _STRINGS_H
+#define _STRINGS_H 1
+
+#define __need_size_t
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+int ffs(int __i);
+int ffsl(long __i);
+int ffsll(long long __i);
+int strcasecmp(const char *__s1, const char *__s2);
+int strncasecmp(const char *__s1, const char *__s2, size_t __n);
+
+#ifdef __cplusplus
+};
+#endif
+
+#endif /* _STRINGS_H */
@@ -0,0 +1,236 @@
+#include "digits.p.h"
+#include "compiler.h"
+#include "errno.h"
+#include "ryu/digit_table.h"
+#include "ryu/ryu_low_level.h"
+#include "stdlib.h"
+#include <stddef.h>
+
+#define PAGE_SIZE 4096
+
+static const char lower_digits[] = "0123456789abcdefghijklmnopqrstuvwxyz";
+static const char upper_digits[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZ";
+
+static char *put_pair(char *end, uint32_t pair) {
+    end -= 2;
+    __builtin_memcpy(end, &DIGIT_TABLE[pair * 2], 2);
+    return end;
+}
+
+static char *format_dec32(char *end, uint32_t value) {
+    while (value >= 100) {
+        uint32_t quot = value / 100;
+        end = put_pair(end, value - quot * 100);
+        value = quot;
+    }
+
+    if (value >= 10) return put_pair(end, value);
+    if (value) *--end = '0' + value;
+    return end;
+}
+
+static char *format_dec(char *end, uint64_t value) {
+    // Split off eight digits at a time until the rest fits in 32 bits, so that the remaining divisions are cheap. All
+    // divisors are constants, which the compiler turns into multiplications.
+    while (value > UINT32_MAX) {
+        uint64_t quot = value / 100000000;
+        uint32_t low = value - quot * 100000000;
+
+        for (int i = 0; i < 4; i++) {
+            uint32_t low_quot = low / 100;
+            end = put_pair(end, low - low_quot * 100);
+            low = low_quot;
+        }
+
+        value = quot;
+    }
+
+    return format_dec32(end, value);
+}
+
+char *format_uint(char *end, uint64_t value, unsigned base, bool upper) {
+    if (base == 10) return format_dec(end, value);
+
+    const char *digits = upper ? upper_digits : lower_digits;
+
+    if ((base & (base - 1)) == 0) {
+        unsigned shift = __builtin_ctz(base);
+        unsigned mask = base - 1;
+
+        while (value) {
+            *--end = digits[value & mask];
+            value >>= shift;
+        }
+    } else {
+        while (value) {
+            *--end = digits[value % base];
+            value /= base;
+        }
+    }
+
+    return end;
+}
+
+// Whether an 8-byte load from ptr could touch the next page. Reading past the end of the string is fine otherwise.
+static bool crosses_page(const void *ptr) {
+    return ((uintptr_t)ptr & (PAGE_SIZE - 1)) > PAGE_SIZE - 8;
+}
+
+static bool is_eight_digits(uint64_t value) {
+    return !(((value + 0x4646464646464646) | (value - 0x3030303030303030)) & 0x8080808080808080);
+}
+
+// Combines eight ASCII digits (the first in the lowest byte) in three multiplications.
+static uint32_t parse_eight_digits(uint64_t value) {
+    value -= 0x3030303030303030;
+    value = (value * 10) + (value >> 8);
+    value = (((value & 0x000000ff000000ff) * 0x000f424000000064) +
+             (((value >> 16) & 0x000000ff000000ff) * 0x0000271000000001)) >>
+            32;
+    return value;
+}
+
+const char *parse_dec(const char *str, size_t max_digits, uint64_t *value) {
+    uint64_t cur = *value;
+
+    while (max_digits >= 8 && !crosses_page(str)) {
+        uint64_t chunk;
+        __builtin_memcpy(&chunk, str, sizeof(chunk));
+        if (!is_eight_digits(chunk)) break;
+
+        cur = (cur * 100000000) + parse_eight_digits(chunk);
+        str += 8;
+        max_digits -= 8;
+    }
+
+    while (max_digits > 0 && (unsigned char)(*str - '0') < 10) {
+        cur = (cur * 10) + (*str++ - '0');
+        max_digits--;
+    }
+
+    *value = cur;
+    return str;
+}
+
+EXPORT char *ultochars(char *first, char *last, unsigned long value, int base) {
+    if (base < 2 || base > 36) {
+        errno = __EINVAL;
+        return NULL;
+    }
+
+    char buffer[64];
+    char *end = buffer + sizeof(buffer);
+    char *start = format_uint(end, value, base, false);
+    if (start == end) *--start = '0';
+
+    size_t length = end - start;
+    if ((size_t)(last - first) < length) {
+        errno = __EOVERFLOW;
+        return NULL;
+    }
+
+    __builtin_memcpy(first, start, length);
+    return first + length;
+}
+
+EXPORT char *ltochars(char *first, char *last, long value, int base) {
+    if (value >= 0) return ultochars(first, last, value, base);
+
+    if (first == last) {
+        errno = __EOVERFLOW;
+        return NULL;
+    }
+
+    *first = '-';
+    return ultochars(first + 1, last, -(unsigned long)value, base);
+}
+
+// Writes a shortest round-trip representation like C++'s std::to_chars: fixed or scientific notation, whichever is
+// shorter, preferring fixed on ties. The exponent is printed like printf's %e does.
+static char *format_decimal(char *first, char *last, struct floating_decimal value) {
+    char buffer[32];
+    char *cur = buffer;
+
+    if (value.sign) *cur++ = '-';
+
+    if (value.type != RYU_VALUE) {
+        __builtin_memcpy(cur, value.type == RYU_NAN ? "nan" : "inf", 3);
+        cur += 3;
+    } else if (value.mantissa == 0) {
+        *cur++ = '0';
+    } else {
+        char digits[20];
+        char *end = digits + sizeof(digits);
+        char *start = format_uint(end, value.mantissa, 10, false);
+        int count = end - start;
+        int exponent = value.exponent + count - 1; // of the first digit
+
+        int abs_exponent = exponent < 0 ? -exponent : exponent;
+        int sci_length = count + (count > 1) + 2 + (abs_exponent >= 100 ? 3 : 2);
+        int fixed_length;
+
+        if (exponent < 0) fixed_length = count + 1 - exponent;
+        else if (count <= exponent + 1) fixed_length = exponent + 1;
+        else fixed_length = count + 1;
+
+        if (fixed_length <= sci_length) {
+            if (exponent < 0) {
+                *cur++ = '0';
+                *cur++ = '.';
+                __builtin_memset(cur, '0', -exponent - 1);
+                cur += -exponent - 1;
+                __builtin_memcpy(cur, start, count);
+                cur += count;
+            } else if (count <= exponent + 1) {
+                __builtin_memcpy(cur, start, count);
+                cur += count;
+                __builtin_memset(cur, '0', exponent + 1 - count);
+                cur += exponent + 1 - count;
+            } else {
+                __builtin_memcpy(cur, start, exponent + 1);
+                cur += exponent + 1;
+                *cur++ = '.';
+                __builtin_memcpy(cur, start + exponent + 1, count - exponent - 1);
+                cur += count - exponent - 1;
+            }
+        } else {
+            *cur++ = *start;
+
+            if (count > 1) {
+                *cur++ = '.';
+                __builtin_memcpy(cur, start + 1, count - 1);
+                cur += count - 1;
+            }
+
+            *cur++ = 'e';
+            *cur++ = exponent < 0 ? '-' : '+';
+
+            if (abs_exponent >= 100) {
+                *cur++ = '0' + abs_exponent / 100;
+                abs_exponent %= 100;
+            }
+
+            __builtin_memcpy(cur, &DIGIT_TABLE[abs_exponent * 2], 2);
+            cur += 2;
+        }
+    }
+
+    size_t length = cur - buffer;
+    if ((size_t)(last - first) < length) {
+        errno = __EOVERFLOW;
+        return NULL;
+    }
+
+    __builtin_memcpy(first, buffer, length);
+    return first + length;
+}
+
+EXPORT char *dtochars(char *first, char *last, double value) {
+    uint64_t bits;
+    __builtin_memcpy(&bits, &value, sizeof(bits));
+    return format_decimal(first, last, generic_binary_to_decimal(bits, 52, 11));
+}
+
+EXPORT char *ftochars(char *first, char *last, float value) {
+    return format_decimal(first, last, float_to_decimal(value));
+}
@@ -0,0 +1,16 @@
+#ifndef LIBC_DIGITS_P_H
+#define LIBC_DIGITS_P_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// Writes the digits of `value` in the given base (2 to 36) into the bytes just before `end` and returns a pointer to
+// the first digit. Zero produces no digits at all. Digits above 9 are lowercase unless `upper` is set.
+char *format_uint(char *end, uint64_t value, unsigned base, bool upper);
+
+// Accumulates up to `max_digits` decimal digits starting at `str` into `*value` and returns a pointer past the last
+// digit consumed. Overflow isn't detected; at most 19 digits are guaranteed to fit.
+const char *parse_dec(const char *str, size_t max_digits, uint64_t *value);
+
+#endif // LIBC_DIGITS_P_H
@@ -82,14 +82,23 @@ static bool realloc_large(void **ptr, size_t old, size_t new) {
 
     if (old == new) return true;
 
-    if (old < new) {
+    if (new < old) {
         UNUSED int error = hydrogen_unmap_memory((uintptr_t)*ptr + new, old - new);
         assert(error == 0);
         return true;
     }
 
-    intptr_t res = hydrogen_map_memory((uintptr_t)*ptr + old, new - old, VMM_PRIVATE | VMM_WRITE | VMM_TRY_EXACT, 0, 0);
-    return res >= 0;
+    uintptr_t tail = (uintptr_t)*ptr + old;
+    intptr_t res = hydrogen_map_memory(tail, new - old, VMM_PRIVATE | VMM_WRITE | VMM_TRY_EXACT, 0, 0);
+    if (res < 0) return false;
+
+    // The area after the allocation was taken, so the kernel put the new pages somewhere else
+    if ((uintptr_t)res != tail) {
+        hydrogen_unmap_memory(res, new - old);
+        return false;
+    }
+
+    return true;
 }
 
 static void free_large(void *ptr, size_t size) {
@@ -150,7 +159,15 @@ EXPORT void free(void *ptr) {
 }
 
 EXPORT void *calloc(size_t nmemb, size_t size) {
-    void *ptr = __builtin_malloc(nmemb * size);
-    if (ptr) __builtin_memset(ptr, 0, nmemb * size);
+    size_t total;
+    if (__builtin_mul_overflow(nmemb, size, &total)) {
+        errno = __ENOMEM;
+        return NULL;
+    }
+
+    // Call malloc through the non-builtin name, otherwise the compiler can recognize the malloc+memset pair and
+    // turn it into a call to calloc.
+    void *ptr = malloc(total);
+    if (ptr) __builtin_memset(ptr, 0, total);
     return ptr;
 }
@@ -2,6 +2,7 @@
 #include "compiler.h"
 #include "stdio.p.h"
 #include "stdlib.p.h"
+#include "string.p.h"
 #include <stddef.h>
 #include <stdint.h>
 #include <stdio.h>
@@ -24,6 +25,7 @@ __attribute__((used)) EXPORT _Noreturn void __libc_start(
     while (envp[envc] != NULL) envc += 1;
     init_auxv(&envp[envc + 1]);
 
+    init_string();
     init_stdio();
 
     if (exitfn) atexit(exitfn);
@@ -1,15 +1,24 @@
 #include "assert.h"
 #include "compiler.h"
+#include "digits.p.h"
+#include "errno.h"
 #include "ryu/ryu_low_level.h"
 #include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include <hydrogen/vfs.h>
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 typedef bool (*printf_sink_t)(const void *data, size_t size, void *ptr);
 
+// Writes `count` copies of `c`. Sinks that can do this without going through a buffer of padding provide one.
+typedef bool (*printf_fill_t)(char c, size_t count, void *ptr);
+
 typedef struct {
     printf_sink_t sink;
+    printf_fill_t fill;
     void *ptr;
     int count;
 } printf_ctx_t;
@@ -53,14 +62,33 @@ static bool do_print(printf_ctx_t *ctx, const void *data, size_t size) {
     return !size || ctx->sink(data, size, ctx->ptr);
 }
 
-static bool print_chars(printf_ctx_t *ctx, char c, size_t count) {
-    while (count--) {
-        if (!do_print(ctx, &c, sizeof(c))) return false;
+#define FILL_CHUNK_SIZE 64
+
+static const char fill_spaces[FILL_CHUNK_SIZE] = {[0 ... FILL_CHUNK_SIZE - 1] = ' '};
+static const char fill_zeroes[FILL_CHUNK_SIZE] = {[0 ... FILL_CHUNK_SIZE - 1] = '0'};
+
+// Fallback for sinks without a fill operation. Padding is only ever done with spaces or zeroes.
+static bool fill_chunks(printf_sink_t sink, void *ptr, char c, size_t count) {
+    assert(c == ' ' || c == '0');
+    const char *chunk = c == ' ' ? fill_spaces : fill_zeroes;
+
+    while (count) {
+        size_t cur = count < FILL_CHUNK_SIZE ? count : FILL_CHUNK_SIZE;
+        if (!sink(chunk, cur, ptr)) return false;
+        count -= cur;
     }
 
     return true;
 }
 
+static bool print_chars(printf_ctx_t *ctx, char c, size_t count) {
+    if (!count) return true;
+
+    ctx->count += count;
+    if (ctx->fill) return ctx->fill(c, count, ctx->ptr);
+    return fill_chunks(ctx->sink, ctx->ptr, c, count);
+}
+
 #define PAD(char, count)                                                                                               \
     do {                                                                                                               \
         if (!print_chars(ctx, (char), (count))) return false;                                                          \
@@ -85,23 +113,11 @@ static bool print_chars(printf_ctx_t *ctx, char c, size_t count) {
         if (spec->left_justified && _len < (size_t)spec->field_width) PAD(' ', spec->field_width - _len);              \
     } while (0)
 
-static size_t print_into_buffer(unsigned char *buffer, size_t len, uintmax_t value, unsigned base, char case_adjust) {
-    size_t index = len;
-
-    while (value) {
-        unsigned dval = value % base;
-        value /= base;
-        buffer[--index] = (dval < 10 ? '0' : 'a' - 10 + case_adjust) + dval;
-    }
-
-    return index;
-}
-
 static bool print_int(printf_ctx_t *ctx, printf_spec_t *spec, uintmax_t value, unsigned base, char sign, char prefix) {
     if (spec->precision < 0) spec->precision = 1;
 
-    unsigned char buffer[64];
-    size_t index = print_into_buffer(buffer, sizeof(buffer), value, base, spec->case_adjust);
+    char buffer[64];
+    size_t index = format_uint(buffer + sizeof(buffer), value, base, spec->case_adjust) - buffer;
     size_t raw_len = sizeof(buffer) - index;
     size_t pad_len = raw_len < (size_t)spec->precision ? spec->precision - raw_len : (prefix == '0');
     size_t length = raw_len + pad_len;
@@ -179,277 +195,119 @@ static uint64_t get_fp_bits(double value) {
     return fp.bits;
 }
 
-static struct floating_decimal convert_to_decimal(double value) {
-    return generic_binary_to_decimal(get_fp_bits(value), MANTISSA_BITS, EXPONENT_BITS);
-}
-
-static const uint64_t iexp10[20] = {
-        1ul,
-        10ul,
-        100ul,
-        1000ul,
-        10000ul,
-        100000ul,
-        1000000ul,
-        10000000ul,
-        100000000ul,
-        1000000000ul,
-        10000000000ul,
-        100000000000ul,
-        1000000000000ul,
-        10000000000000ul,
-        100000000000000ul,
-        1000000000000000ul,
-        10000000000000000ul,
-        100000000000000000ul,
-        1000000000000000000ul,
-        10000000000000000000ul,
-};
-
-#define MAX_DIGITS (sizeof(iexp10) / sizeof(*iexp10))
+static double from_fp_bits(uint64_t bits) {
+    union {
+        uint64_t bits;
+        double value;
+    } fp;
+    fp.bits = bits;
+    return fp.value;
+}
 
-static unsigned count_digits(uint64_t value) {
-    for (size_t i = MAX_DIGITS - 1; i > 0; i--) {
-        if (value >= iexp10[i]) return i + 1;
-    }
+#define SIGN_BIT (1ul << (MANTISSA_BITS + EXPONENT_BITS))
+#define EXPONENT_MASK ((1ul << EXPONENT_BITS) - 1)
+#define MANTISSA_MASK ((1ul << MANTISSA_BITS) - 1)
 
-    return 1;
-}
+// Digits past these limits are always zero: a double has at most 309 digits before the decimal point, 1074 after it,
+// and 767 significant digits in total. Precision beyond them is printed as padding.
+#define MAX_FIXED_PRECISION 1074
+#define MAX_SCI_PRECISION 767
+#define FLOAT_BUFFER_SIZE (309 + 1 + MAX_FIXED_PRECISION)
 
-static char get_sign(printf_spec_t *spec, struct floating_decimal value) {
-    if (value.sign) {
-        return '-';
-    } else {
-        return spec->positive_sign;
-    }
+// Returns the index of the exponent in the output of d2exp_buffered_n.
+static size_t find_exponent(const char *buffer, size_t length) {
+    while (buffer[--length] != 'e');
+    return length;
 }
 
-static bool do_float_dec(printf_ctx_t *ctx, printf_spec_t *spec, struct floating_decimal value, bool remove_trailing) {
-    char sign = get_sign(spec, value);
-    const char *fixed;
+static bool do_float(printf_ctx_t *ctx, printf_spec_t *spec, double value, printf_conv_t conv) {
+    uint64_t bits = get_fp_bits(value);
+    char sign = bits & SIGN_BIT ? '-' : spec->positive_sign;
+    value = from_fp_bits(bits & ~SIGN_BIT);
 
-    switch (value.type) {
-    case RYU_NAN: fixed = spec->case_adjust ? "NAN" : "nan"; goto fixed;
-    case RYU_INFINITY: fixed = spec->case_adjust ? "INF" : "inf"; goto fixed;
-    case RYU_VALUE: break;
-    }
-
-    int prec;
-    if (spec->precision >= 0) prec = spec->precision;
-    else prec = 6;
+    if (((bits >> MANTISSA_BITS) & EXPONENT_MASK) == EXPONENT_MASK) {
+        const char *fixed;
+        if (bits & MANTISSA_MASK) fixed = spec->case_adjust ? "NAN" : "nan";
+        else fixed = spec->case_adjust ? "INF" : "inf";
 
-    // round mantissa if necessary
-    if (value.exponent < 0) {
-        int fract_digits = -value.exponent;
-        int extra_digits = fract_digits - prec;
+        size_t len = !!sign + 3;
 
-        if (extra_digits > 0) {
-            if (extra_digits < (int)MAX_DIGITS) {
-                uint64_t divisor = iexp10[extra_digits];
-                value.mantissa = (value.mantissa + (divisor / 2)) / divisor;
-            } else {
-                value.mantissa = 0;
-            }
+        PREPARE(len);
+        if (sign) PRINT(&sign, sizeof(sign));
+        PRINT(fixed, 3);
+        FINALIZE(len);
 
-            value.exponent += extra_digits;
-        }
+        return true;
     }
 
-    // print the mantissa as an integer
-    unsigned char mantissa_buf[MAX_DIGITS];
-    size_t mantissa_idx = print_into_buffer(mantissa_buf, sizeof(mantissa_buf), value.mantissa, 10, 0);
-    size_t mantissa_len = sizeof(mantissa_buf) - mantissa_idx;
+    size_t prec = spec->precision >= 0 ? spec->precision : 6;
+    bool remove_trailing = false;
+    char buffer[FLOAT_BUFFER_SIZE];
+    size_t length = 0;
 
-    // determine location of decimal point within mantissa buffer, as well as the necessary padding zeroes
+    if (conv == CONV_FLOAT_AUTO) {
+        // the exponent after rounding to the requested number of significant digits determines the style
+        if (prec == 0) prec = 1;
+        prec -= 1;
 
-    size_t pre_dec_zeroes;
-    size_t decimal_index;
-    size_t post_dec_zeroes;
-    size_t post_frac_zeroes;
+        length = d2exp_buffered_n(value, prec < MAX_SCI_PRECISION ? prec : MAX_SCI_PRECISION, buffer);
+        size_t exp_idx = find_exponent(buffer, length);
+        int exponent = 0;
 
-    if (value.exponent >= 0) {
-        pre_dec_zeroes = value.exponent;
-        decimal_index = mantissa_len;
-        post_dec_zeroes = 0;
-        post_frac_zeroes = !remove_trailing ? prec : 0;
-    } else {
-        int frac_len = -value.exponent;
-
-        if (frac_len < (int)mantissa_len) {
-            pre_dec_zeroes = 0;
-            decimal_index = mantissa_len - frac_len;
-            post_dec_zeroes = 0;
-        } else if (frac_len == (int)mantissa_len) {
-            pre_dec_zeroes = 1;
-            decimal_index = 0;
-            post_dec_zeroes = 0;
-        } else {
-            pre_dec_zeroes = 1;
-            decimal_index = 0;
-            post_dec_zeroes = frac_len - mantissa_len;
+        for (size_t i = exp_idx + 2; i < length; i++) {
+            exponent = (exponent * 10) + (buffer[i] - '0');
         }
 
-        int extra_digits = frac_len - prec;
+        if (buffer[exp_idx + 1] == '-') exponent = -exponent;
 
-        if (extra_digits < 0) {
-            post_frac_zeroes = prec - frac_len;
+        if (exponent >= -4 && exponent <= (int)prec) {
+            conv = CONV_FLOAT_DEC;
+            prec -= exponent;
         } else {
-            if (extra_digits > 0) {
-                if (mantissa_len >= (size_t)extra_digits) {
-                    mantissa_len -= extra_digits;
-                } else {
-                    post_dec_zeroes -= extra_digits - mantissa_len;
-                    mantissa_len = 0;
-                }
-            }
-
-            post_frac_zeroes = 0;
+            conv = CONV_FLOAT_SCI;
         }
 
-        if (remove_trailing) {
-            while (decimal_index < mantissa_len && mantissa_buf[mantissa_idx + mantissa_len - 1] == '0') {
-                mantissa_len -= 1;
-            }
-
-            if (decimal_index == mantissa_idx) post_dec_zeroes = 0;
-            post_frac_zeroes = 0;
-        }
+        remove_trailing = !spec->alternate;
+    } else if (conv == CONV_FLOAT_SCI) {
+        length = d2exp_buffered_n(value, prec < MAX_SCI_PRECISION ? prec : MAX_SCI_PRECISION, buffer);
     }
 
-    size_t whole_digits = decimal_index + pre_dec_zeroes;
-    size_t real_frac_digits = mantissa_len - decimal_index;
-    size_t frac_digits = post_dec_zeroes + real_frac_digits + post_frac_zeroes;
-
-    // determine how many padding chars are needed to fill the field, and pad if right-justified without zero-padding
-
-    size_t whole_length = !!sign + whole_digits;
-    size_t frac_length = (frac_digits || spec->alternate) + frac_digits;
-    size_t field_length = whole_length + frac_length;
-    size_t pad_len;
-
-    if (field_length < (size_t)spec->field_width) {
-        pad_len = spec->field_width;
-
-        if (!spec->pad_zero && !spec->left_justified) {
-            PAD(' ', pad_len);
-            pad_len = 0;
-        }
+    size_t digits_len, exp_len;
+    const char *exp_str;
+    size_t zeroes;
+
+    if (conv == CONV_FLOAT_DEC) {
+        size_t computed = prec < MAX_FIXED_PRECISION ? prec : MAX_FIXED_PRECISION;
+        length = d2fixed_buffered_n(value, computed, buffer);
+        digits_len = length;
+        exp_str = NULL;
+        exp_len = 0;
+        zeroes = prec - computed;
     } else {
-        pad_len = 0;
-    }
-
-    // print sign, pad if zero-padded, and print part of mantissa before decimal point
-    if (sign) PRINT(&sign, sizeof(sign));
-    if (spec->pad_zero) {
-        PAD('0', pad_len);
-        pad_len = 0;
-    }
-    PRINT(&mantissa_buf[mantissa_idx], decimal_index);
-    PAD('0', pre_dec_zeroes);
-
-    // print the fractional part
-    if (frac_length) {
-        char c = '.';
-        PRINT(&c, sizeof(c));
-        PAD('0', post_dec_zeroes);
-        PRINT(&mantissa_buf[mantissa_idx + decimal_index], real_frac_digits);
-        PAD('0', post_frac_zeroes);
-    }
-
-    // pad if left-justified
-    PAD(' ', pad_len);
-
-    return true;
-
-fixed: {
-    size_t len = !!sign + 3;
-
-    PREPARE(len);
-    if (sign) PRINT(&sign, sizeof(sign));
-    PRINT(fixed, 3);
-    FINALIZE(len);
-
-    return true;
-}
-}
-
-static int get_sci_exponent(struct floating_decimal value, int *frac_digits_out) {
-    int frac_digits = count_digits(value.mantissa) - 1;
-    if (frac_digits_out) *frac_digits_out = frac_digits;
-    return value.exponent + frac_digits;
-}
-
-static bool do_float_sci(printf_ctx_t *ctx, printf_spec_t *spec, struct floating_decimal value, bool remove_trailing) {
-    size_t prec;
-    if (spec->precision >= 0) prec = spec->precision;
-    else prec = 6;
-
-    // get the real exponent and round the mantissa if necessary
-    int frac_len;
-    int exponent = get_sci_exponent(value, &frac_len);
-    int extra_digits = frac_len - prec;
-    if (extra_digits > 0) {
-        uint64_t divisor = iexp10[extra_digits];
-        value.mantissa = (value.mantissa + (divisor / 2)) / divisor;
-    }
-
-    // print the components as integers
-    bool exponent_neg = exponent < 0;
-    if (exponent_neg) exponent = -exponent;
-
-    unsigned char mantissa_buf[MAX_DIGITS];
-    unsigned char exponent_buf[MAX_DIGITS + 2];
-    size_t mantissa_idx = print_into_buffer(mantissa_buf, sizeof(mantissa_buf), value.mantissa, 10, 0);
-    size_t exponent_idx = print_into_buffer(exponent_buf, sizeof(exponent_buf), exponent, 10, 0);
-    size_t mantissa_len = sizeof(mantissa_buf) - mantissa_idx;
-    size_t exponent_len = sizeof(exponent_buf) - exponent_idx;
-
-    // make sure the buffers are formatted correctly
-
-    if (mantissa_len == 0) {
-        mantissa_buf[--mantissa_idx] = '0';
-        mantissa_len = 1;
+        digits_len = find_exponent(buffer, length);
+        exp_str = &buffer[digits_len];
+        exp_len = length - digits_len;
+        zeroes = prec - (prec < MAX_SCI_PRECISION ? prec : MAX_SCI_PRECISION);
+        buffer[digits_len] += spec->case_adjust;
     }
 
-    while (exponent_len < 2) {
-        exponent_buf[--exponent_idx] = '0';
-        exponent_len += 1;
-    }
-
-    exponent_buf[--exponent_idx] = "+-"[exponent_neg];
-    exponent_buf[--exponent_idx] = 'e' + spec->case_adjust;
-    exponent_len += 2;
-
-    // calculate the total printed length without padding (except for the digits printed for precision)
-
-    size_t real_frac_digits = mantissa_len - 1;
-    size_t post_frac_zeroes;
-
     if (remove_trailing) {
-        post_frac_zeroes = 0;
+        zeroes = 0;
 
-        while (real_frac_digits > 0 && mantissa_buf[mantissa_idx + real_frac_digits] == '0') {
-            real_frac_digits -= 1;
+        if (prec != 0) {
+            while (buffer[digits_len - 1] == '0') digits_len--;
+            if (buffer[digits_len - 1] == '.') digits_len--;
         }
-    } else if (real_frac_digits < prec) {
-        post_frac_zeroes = prec - real_frac_digits;
-    } else {
-        // due to the rounding earlier, it shouldn't be possible for the fractional length to exceed the precision
-        assert(real_frac_digits == prec);
-        post_frac_zeroes = 0;
     }
 
-    size_t frac_digits = real_frac_digits + post_frac_zeroes;
-    size_t frac_length = frac_digits + (frac_digits || spec->alternate); // \.[0-9]*
+    // '#' means the decimal point is printed even if no digits follow it
+    bool add_point = spec->alternate && prec == 0;
 
-    char sign = get_sign(spec, value);
-    size_t whole_len = !!sign + 1; // [+- ]?[0-9]
+    // determine how many padding chars are needed to fill the field, and pad if right-justified without zero-padding
 
-    size_t field_length = whole_len + frac_length + exponent_len;
+    size_t field_length = !!sign + digits_len + add_point + zeroes + exp_len;
     size_t pad_len;
 
-    // determine how many padding chars are needed to fill the field, and pad if right-justified without zero-padding
-
     if (field_length < (size_t)spec->field_width) {
         pad_len = spec->field_width - field_length;
 
@@ -461,58 +319,39 @@ static bool do_float_sci(printf_ctx_t *ctx, printf_spec_t *spec, struct floating
         pad_len = 0;
     }
 
-    // print sign, pad if zero-padded, and print the digit before the decimal point
+    // print sign, pad if zero-padded, and print the number itself
     if (sign) PRINT(&sign, sizeof(sign));
     if (spec->pad_zero) {
         PAD('0', pad_len);
         pad_len = 0;
     }
-    PRINT(&mantissa_buf[mantissa_idx], 1);
 
-    // print the fractional part
-    if (frac_length) {
+    PRINT(buffer, digits_len);
+
+    if (add_point) {
         char c = '.';
         PRINT(&c, sizeof(c));
-        PRINT(&mantissa_buf[mantissa_idx + 1], real_frac_digits);
-        PAD('0', post_frac_zeroes);
     }
 
-    // print the exponent and pad if left-justified
-    PRINT(&exponent_buf[exponent_idx], exponent_len);
+    PAD('0', zeroes);
+    PRINT(exp_str, exp_len);
+
+    // pad if left-justified
     PAD(' ', pad_len);
 
     return true;
 }
 
 PRINT_FUNC(FLOAT_DEC, double) {
-    return do_float_dec(ctx, spec, convert_to_decimal(value), false);
+    return do_float(ctx, spec, value, CONV_FLOAT_DEC);
 }
 
 PRINT_FUNC(FLOAT_SCI, double) {
-    struct floating_decimal v = convert_to_decimal(value);
-
-    return v.type == RYU_VALUE ? do_float_sci(ctx, spec, v, false) : do_float_dec(ctx, spec, v, false);
+    return do_float(ctx, spec, value, CONV_FLOAT_SCI);
 }
 
 PRINT_FUNC(FLOAT_AUTO, double) {
-    int prec = spec->precision;
-    if (prec < 0) prec = 6;
-    else if (prec == 0) prec = 1;
-
-    struct floating_decimal v = convert_to_decimal(value);
-
-    if (v.type == RYU_VALUE) {
-        int exp = get_sci_exponent(v, NULL);
-
-        if (exp < -4 || exp >= prec) {
-            spec->precision = prec - 1;
-            return do_float_sci(ctx, spec, v, !spec->alternate);
-        }
-
-        spec->precision = prec - (exp + 1);
-    }
-
-    return do_float_dec(ctx, spec, v, !spec->alternate);
+    return do_float(ctx, spec, value, CONV_FLOAT_AUTO);
 }
 
 PRINT_FUNC(CHAR, char) {
@@ -641,8 +480,20 @@ static int parse_specifier(const char *format, printf_spec_t *out) {
     return format - start;
 }
 
+// Returns the next conversion specification in [format, end), or NULL if there is none. A '%' that doesn't start a
+// valid specification is printed as-is, so it's skipped here and becomes part of the literal text.
+static const char *next_specifier(const char *format, const char *end, printf_spec_t *spec, int *length) {
+    while ((format = memchr(format, '%', end - format)) != NULL) {
+        *length = parse_specifier(format, spec);
+        if (*length) return format;
+        format++;
+    }
+
+    return NULL;
+}
+
 #define EXTRACT(func, len, type, vtype)                                                                                \
-    case LEN_##len: r = print_##func(&ctx, &spec, (type)va_arg(args, vtype)); break
+    case LEN_##len: r = print_##func(ctx, &spec, (type)va_arg(*args, vtype)); break
 
 #define UINTCONV(type)                                                                                                 \
     case CONV_##type:                                                                                                  \
@@ -664,77 +515,265 @@ static int parse_specifier(const char *format, printf_spec_t *out) {
         }                                                                                                              \
         break
 
-static int do_printf(printf_sink_t sink, void *ptr, const char *format, va_list args) {
-    printf_ctx_t ctx = {sink, ptr, 0};
-    const char *last = format;
+// The spec is passed by value because printing modifies it, and a compiled format must stay intact.
+static bool print_spec(printf_ctx_t *ctx, printf_spec_t spec, va_list *args) {
+    if (spec.field_width == OPT_ARG) {
+        spec.field_width = va_arg(*args, int);
+        if (spec.field_width < 0) {
+            spec.field_width = -spec.field_width;
+            spec.left_justified = true;
+        }
+    }
 
-    for (char c = *format; c != 0; c = *++format) {
-        if (c != '%') continue;
+    if (spec.precision == OPT_ARG) {
+        spec.precision = va_arg(*args, int);
+    }
 
-        printf_spec_t spec;
-        int length = parse_specifier(format, &spec);
-        if (!length) continue;
-        if (last != format && !do_print(&ctx, last, format - last)) return -1;
-        last = format + length;
-        format = last - 1;
-
-        if (spec.field_width == OPT_ARG) {
-            spec.field_width = va_arg(args, int);
-            if (spec.field_width < 0) {
-                spec.field_width = -spec.field_width;
-                spec.left_justified = true;
-            }
+    bool r = false;
+    switch (spec.conv) {
+    case CONV_SINT:
+        switch (spec.length) {
+        case LEN_LONG_DOUBLE:
+        case LEN_DEFAULT: r = print_SINT(ctx, &spec, va_arg(*args, int)); break;
+        case LEN_SHORT: r = print_SINT(ctx, &spec, (short)va_arg(*args, int)); break;
+        case LEN_LONG: r = print_SINT(ctx, &spec, va_arg(*args, long)); break;
         }
-
-        if (spec.precision == OPT_ARG) {
-            spec.precision = va_arg(args, int);
+        break;
+        UINTCONV(UINT);
+        UINTCONV(OCT);
+        UINTCONV(HEX);
+        FLTCONV(DEC);
+        FLTCONV(SCI);
+        FLTCONV(AUTO);
+    case CONV_CHAR: r = print_CHAR(ctx, &spec, va_arg(*args, int)); break;
+    case CONV_STRING: r = print_STRING(ctx, &spec, va_arg(*args, const char *)); break;
+    case CONV_POINTER: r = print_POINTER(ctx, &spec, va_arg(*args, void *)); break;
+    case CONV_WRITEBACK:
+        r = true;
+        switch (spec.length) {
+        case LEN_LONG_DOUBLE:
+        case LEN_DEFAULT: *va_arg(*args, int *) = ctx->count; break;
+        case LEN_SHORT: *va_arg(*args, short *) = ctx->count; break;
+        case LEN_LONG: *va_arg(*args, long *) = ctx->count; break;
         }
+        break;
+    case CONV_PERCENT: r = print_CHAR(ctx, &spec, '%'); break;
+    }
 
-        bool r;
-        switch (spec.conv) {
-        case CONV_SINT:
-            switch (spec.length) {
-            case LEN_LONG_DOUBLE:
-            case LEN_DEFAULT: r = print_SINT(&ctx, &spec, va_arg(args, int)); break;
-            case LEN_SHORT: r = print_SINT(&ctx, &spec, (short)va_arg(args, int)); break;
-            case LEN_LONG: r = print_SINT(&ctx, &spec, va_arg(args, long)); break;
-            }
-            break;
-            UINTCONV(UINT);
-            UINTCONV(OCT);
-            UINTCONV(HEX);
-            FLTCONV(DEC);
-            FLTCONV(SCI);
-            FLTCONV(AUTO);
-        case CONV_CHAR: r = print_CHAR(&ctx, &spec, va_arg(args, int)); break;
-        case CONV_STRING: r = print_STRING(&ctx, &spec, va_arg(args, const char *)); break;
-        case CONV_POINTER: r = print_POINTER(&ctx, &spec, va_arg(args, void *)); break;
-        case CONV_WRITEBACK:
-            r = true;
-            switch (spec.length) {
-            case LEN_LONG_DOUBLE:
-            case LEN_DEFAULT: *va_arg(args, int *) = ctx.count; break;
-            case LEN_SHORT: *va_arg(args, short *) = ctx.count; break;
-            case LEN_LONG: *va_arg(args, long *) = ctx.count; break;
-            }
-            break;
-        case CONV_PERCENT: r = print_CHAR(&ctx, &spec, '%'); break;
+    return r;
+}
+
+static int do_printf(printf_sink_t sink, printf_fill_t fill, void *ptr, const char *format, va_list args) {
+    printf_ctx_t ctx = {sink, fill, ptr, 0};
+    const char *end = format + __builtin_strlen(format);
+    int ret = -1;
+    va_list ap;
+    va_copy(ap, args);
+
+    for (;;) {
+        printf_spec_t spec;
+        int length;
+        const char *cur = next_specifier(format, end, &spec, &length);
+        if (!cur) break;
+
+        if (!do_print(&ctx, format, cur - format) || !print_spec(&ctx, spec, &ap)) goto exit;
+        format = cur + length;
+    }
+
+    if (do_print(&ctx, format, end - format)) ret = ctx.count;
+exit:
+    va_end(ap);
+    return ret;
+}
+
+typedef struct {
+    const char *literal; // printed before the conversion
+    size_t literal_length;
+    printf_spec_t spec;
+} printf_item_t;
+
+struct __printf_format {
+    size_t count;
+    const char *tail; // printed after the last conversion
+    size_t tail_length;
+    printf_item_t items[];
+};
+
+static int do_printf_compiled(
+        printf_sink_t sink,
+        printf_fill_t fill,
+        void *ptr,
+        const printf_format_t *format,
+        va_list args
+) {
+    printf_ctx_t ctx = {sink, fill, ptr, 0};
+    int ret = -1;
+    va_list ap;
+    va_copy(ap, args);
+
+    for (size_t i = 0; i < format->count; i++) {
+        const printf_item_t *item = &format->items[i];
+        if (!do_print(&ctx, item->literal, item->literal_length) || !print_spec(&ctx, item->spec, &ap)) goto exit;
+    }
+
+    if (do_print(&ctx, format->tail, format->tail_length)) ret = ctx.count;
+exit:
+    va_end(ap);
+    return ret;
+}
+
+EXPORT printf_format_t *printf_compile(const char *format) {
+    size_t size = __builtin_strlen(format);
+    const char *end = format + size;
+    printf_spec_t spec;
+    int length = 0;
+    size_t count = 0;
+
+    for (const char *cur = format; (cur = next_specifier(cur, end, &spec, &length)) != NULL; cur += length) {
+        count++;
+    }
+
+    // the items and a copy of the string share one allocation, so the result can be released with free
+    printf_format_t *compiled = malloc(sizeof(*compiled) + count * sizeof(*compiled->items) + size + 1);
+    if (!compiled) return NULL;
+
+    char *text = (char *)&compiled->items[count];
+    __builtin_memcpy(text, format, size + 1);
+    end = text + size;
+
+    const char *last = text;
+    for (size_t i = 0; i < count; i++) {
+        printf_item_t *item = &compiled->items[i];
+        const char *cur = next_specifier(last, end, &item->spec, &length);
+
+        item->literal = last;
+        item->literal_length = cur - last;
+        last = cur + length;
+    }
+
+    compiled->count = count;
+    compiled->tail = last;
+    compiled->tail_length = end - last;
+    return compiled;
+}
+
+#define STAGING_SIZE 1024
+
+// Collects output in a buffer so that it reaches an unbuffered destination with as few writes as possible. Besides
+// being faster, this keeps a line that fits in the buffer from being interleaved with the output of other writers.
+typedef struct {
+    printf_sink_t sink;
+    void *ptr;
+    size_t length;
+    unsigned char buffer[STAGING_SIZE];
+} staging_ctx_t;
+
+static bool staging_flush(staging_ctx_t *ctx) {
+    size_t length = ctx->length;
+    ctx->length = 0;
+    return !length || ctx->sink(ctx->buffer, length, ctx->ptr);
+}
+
+static bool staging_fill(char c, size_t count, void *ptr) {
+    staging_ctx_t *ctx = ptr;
+
+    for (;;) {
+        size_t cur = sizeof(ctx->buffer) - ctx->length;
+        if (cur > count) cur = count;
+
+        __builtin_memset(&ctx->buffer[ctx->length], c, cur);
+        ctx->length += cur;
+        count -= cur;
+
+        if (!count) return true;
+        if (!staging_flush(ctx)) return false;
+    }
+}
+
+static bool staging_sink(const void *data, size_t size, void *ptr) {
+    staging_ctx_t *ctx = ptr;
+
+    if (size > sizeof(ctx->buffer) - ctx->length) {
+        if (!staging_flush(ctx)) return false;
+        if (size >= sizeof(ctx->buffer)) return ctx->sink(data, size, ctx->ptr);
+    }
+
+    __builtin_memcpy(&ctx->buffer[ctx->length], data, size);
+    ctx->length += size;
+    return true;
+}
+
+static void staging_init(staging_ctx_t *ctx, printf_sink_t sink, void *ptr) {
+    ctx->sink = sink;
+    ctx->ptr = ptr;
+    ctx->length = 0;
+}
+
+static int staging_finish(staging_ctx_t *ctx, int ret) {
+    if (ret >= 0 && !staging_flush(ctx)) return -1;
+    return ret;
+}
+
+static int do_printf_staged(printf_sink_t sink, void *ptr, const char *format, va_list args) {
+    staging_ctx_t ctx;
+    staging_init(&ctx, sink, ptr);
+    return staging_finish(&ctx, do_printf(staging_sink, staging_fill, &ctx, format, args));
+}
+
+static bool fd_sink(const void *data, size_t size, void *ctx) {
+    int fd = *(int *)ctx;
+
+    while (size) {
+        hydrogen_io_res_t res = hydrogen_write(fd, data, size);
+        if (res.error) {
+            errno = res.error;
+            return false;
         }
-        if (!r) return -1;
+        if (!res.transferred) return false;
+
+        data += res.transferred;
+        size -= res.transferred;
     }
 
-    if (last != format && !do_print(&ctx, last, format - last)) return -1;
-    return ctx.count;
+    return true;
 }
 
 static bool file_sink(const void *data, size_t size, void *ctx) {
     return fwrite(data, 1, size, ctx) == size;
 }
 
+static bool file_fill(char c, size_t count, void *ctx) {
+    FILE *stream = ctx;
+
+    // Padding never contains newlines, so it can go straight into the buffer even if the stream is line buffered
+    if (stream->__wpos && (size_t)(stream->__wend - stream->__wpos) >= count) {
+        __builtin_memset(stream->__wpos, c, count);
+        stream->__wpos += count;
+        return true;
+    }
+
+    return fill_chunks(file_sink, stream, c, count);
+}
+
+static int do_fprintf(FILE *stream, const char *format, va_list args) {
+    if (stream->__mode == _IONBF) return do_printf_staged(file_sink, stream, format, args);
+    return do_printf(file_sink, file_fill, stream, format, args);
+}
+
+static int do_fprintf_compiled(FILE *stream, const printf_format_t *format, va_list args) {
+    if (stream->__mode == _IONBF) {
+        staging_ctx_t ctx;
+        staging_init(&ctx, file_sink, stream);
+        return staging_finish(&ctx, do_printf_compiled(staging_sink, staging_fill, &ctx, format, args));
+    }
+
+    return do_printf_compiled(file_sink, file_fill, stream, format, args);
+}
+
 EXPORT int fprintf(FILE *restrict stream, const char *restrict format, ...) {
     va_list args;
     va_start(args, format);
-    int ret = do_printf(file_sink, stream, format, args);
+    int ret = do_fprintf(stream, format, args);
     va_end(args);
     return ret;
 }
@@ -742,7 +781,7 @@ EXPORT int fprintf(FILE *restrict stream, const char *restrict format, ...) {
 EXPORT int printf(const char *restrict format, ...) {
     va_list args;
     va_start(args, format);
-    int ret = do_printf(file_sink, stdout, format, args);
+    int ret = do_fprintf(stdout, format, args);
     va_end(args);
     return ret;
 }
@@ -754,25 +793,187 @@ static bool string_sink(const void *data, size_t size, void *ctx) {
     return true;
 }
 
+static bool string_fill(char c, size_t count, void *ctx) {
+    char **ptr = ctx;
+    __builtin_memset(*ptr, c, count);
+    *ptr += count;
+    return true;
+}
+
 EXPORT int sprintf(char *restrict s, const char *restrict format, ...) {
     va_list args;
     va_start(args, format);
-    int ret = do_printf(string_sink, (char **)&s, format, args);
+    int ret = do_printf(string_sink, string_fill, (char **)&s, format, args);
     va_end(args);
     if (ret >= 0) *s = 0;
     return ret;
 }
 
+typedef struct {
+    char *cur;
+    size_t avail; // not including the space for the terminator
+} bounded_string_t;
+
+// Truncates the output, but keeps accepting it so the full length is still counted
+static bool bounded_string_sink(const void *data, size_t size, void *ctx) {
+    bounded_string_t *str = ctx;
+    if (size > str->avail) size = str->avail;
+
+    __builtin_memcpy(str->cur, data, size);
+    str->cur += size;
+    str->avail -= size;
+    return true;
+}
+
+static bool bounded_string_fill(char c, size_t count, void *ctx) {
+    bounded_string_t *str = ctx;
+    if (count > str->avail) count = str->avail;
+
+    __builtin_memset(str->cur, c, count);
+    str->cur += count;
+    str->avail -= count;
+    return true;
+}
+
+EXPORT int snprintf(char *restrict s, size_t n, const char *restrict format, ...) {
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf(s, n, format, args);
+    va_end(args);
+    return ret;
+}
+
+EXPORT int vsnprintf(char *restrict s, size_t n, const char *restrict format, va_list arg) {
+    bounded_string_t str = {s, n ? n - 1 : 0};
+    int ret = do_printf(bounded_string_sink, bounded_string_fill, &str, format, arg);
+    if (n) *str.cur = 0;
+    return ret;
+}
+
+EXPORT int asprintf(char **restrict strp, const char *restrict format, ...) {
+    va_list args;
+    va_start(args, format);
+    int ret = vasprintf(strp, format, args);
+    va_end(args);
+    return ret;
+}
+
+EXPORT int vasprintf(char **restrict strp, const char *restrict format, va_list arg) {
+    va_list copy;
+    va_copy(copy, arg);
+    int length = vsnprintf(NULL, 0, format, copy);
+    va_end(copy);
+    if (length < 0) return length;
+
+    char *buffer = malloc((size_t)length + 1);
+    if (!buffer) return -1;
+
+    bounded_string_t str = {buffer, length};
+    do_printf(bounded_string_sink, bounded_string_fill, &str, format, arg);
+    *str.cur = 0;
+
+    *strp = buffer;
+    return length;
+}
+
+EXPORT int dprintf(int fd, const char *restrict format, ...) {
+    va_list args;
+    va_start(args, format);
+    int ret = vdprintf(fd, format, args);
+    va_end(args);
+    return ret;
+}
+
+EXPORT int vdprintf(int fd, const char *restrict format, va_list arg) {
+    return do_printf_staged(fd_sink, &fd, format, arg);
+}
+
 EXPORT int vfprintf(FILE *restrict stream, const char *restrict format, va_list arg) {
-    return do_printf(file_sink, stream, format, arg);
+    return do_fprintf(stream, format, arg);
 }
 
 EXPORT int vprintf(const char *restrict format, va_list arg) {
-    return do_printf(file_sink, stdout, format, arg);
+    return do_fprintf(stdout, format, arg);
 }
 
 EXPORT int vsprintf(char *restrict s, const char *restrict format, va_list arg) {
-    int ret = do_printf(string_sink, (char **)&s, format, arg);
+    int ret = do_printf(string_sink, string_fill, (char **)&s, format, arg);
     if (ret >= 0) *s = 0;
     return ret;
 }
+
+// The format of strfrom* is restricted to "%[.precision]conversion", so it's handled here instead of going through
+// do_printf. Hexadecimal conversions aren't supported, just like in printf.
+static int do_strfrom(char *restrict str, size_t n, const char *restrict format, double fp) {
+    printf_spec_t spec = {.precision = -1, .length = LEN_DEFAULT};
+
+    if (*format++ != '%') goto invalid;
+
+    if (*format == '.') {
+        spec.precision = 0;
+
+        while (*++format >= '0' && *format <= '9') {
+            spec.precision = (spec.precision * 10) + (*format - '0');
+        }
+    }
+
+    switch (*format++) {
+    case 'F': spec.case_adjust = 'A' - 'a'; // fall through
+    case 'f': spec.conv = CONV_FLOAT_DEC; break;
+    case 'E': spec.case_adjust = 'A' - 'a'; // fall through
+    case 'e': spec.conv = CONV_FLOAT_SCI; break;
+    case 'G': spec.case_adjust = 'G' - 'g'; // fall through
+    case 'g': spec.conv = CONV_FLOAT_AUTO; break;
+    default: goto invalid;
+    }
+
+    if (*format) goto invalid;
+
+    bounded_string_t bounded = {str, n ? n - 1 : 0};
+    printf_ctx_t ctx = {bounded_string_sink, bounded_string_fill, &bounded, 0};
+    do_float(&ctx, &spec, fp, spec.conv);
+    if (n) *bounded.cur = 0;
+    return ctx.count;
+invalid:
+    errno = __EINVAL;
+    return -1;
+}
+
+EXPORT int strfromd(char *restrict str, size_t n, const char *restrict format, double fp) {
+    return do_strfrom(str, n, format, fp);
+}
+
+EXPORT int strfromf(char *restrict str, size_t n, const char *restrict format, float fp) {
+    return do_strfrom(str, n, format, fp);
+}
+
+EXPORT int strfroml(char *restrict str, size_t n, const char *restrict format, long double fp) {
+    return do_strfrom(str, n, format, fp);
+}
+
+EXPORT int fprintf_compiled(FILE *restrict stream, const printf_format_t *restrict format, ...) {
+    va_list args;
+    va_start(args, format);
+    int ret = do_fprintf_compiled(stream, format, args);
+    va_end(args);
+    return ret;
+}
+
+EXPORT int snprintf_compiled(char *restrict s, size_t n, const printf_format_t *restrict format, ...) {
+    va_list args;
+    va_start(args, format);
+    int ret = vsnprintf_compiled(s, n, format, args);
+    va_end(args);
+    return ret;
+}
+
+EXPORT int vfprintf_compiled(FILE *restrict stream, const printf_format_t *restrict format, va_list arg) {
+    return do_fprintf_compiled(stream, format, arg);
+}
+
+EXPORT int vsnprintf_compiled(char *restrict s, size_t n, const printf_format_t *restrict format, va_list arg) {
+    bounded_string_t str = {s, n ? n - 1 : 0};
+    int ret = do_printf_compiled(bounded_string_sink, bounded_string_fill, &str, format, arg);
+    if (n) *str.cur = 0;
+    return ret;
+}
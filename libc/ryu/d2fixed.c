@@ -0,0 +1,498 @@
+// Copyright 2018 Ulf Adams
+//
+// The contents of this file may be used under the terms of the Apache License,
+// Version 2.0.
+//
+//    (See accompanying file LICENSE-Apache or copy at
+//     http://www.apache.org/licenses/LICENSE-2.0)
+//
+// Alternatively, the contents of this file may be used under the terms of
+// the Boost Software License, Version 1.0.
+//    (See accompanying file LICENSE-Boost or copy at
+//     https://www.boost.org/LICENSE_1_0.txt)
+//
+// Unless required by applicable law or agreed to in writing, this software
+// is distributed on an "AS IS" BASIS, WITHOUT WARRANTIES OR CONDITIONS OF ANY
+// KIND, either express or implied.
+
+// Implements the printf-style conversions from "Ryū revisited: printf floating point conversion" (Ulf Adams, 2019).
+//
+// The tables in d2fixed_full_table.h are defined as follows:
+//   POW10_SPLIT[POW10_OFFSET[idx] + i] = floor(2^(16 * idx + 120) / 10^(9 * i)) + 1
+//   POW10_SPLIT_2[POW10_OFFSET_2[idx] + i - MIN_BLOCK_2[idx]] = floor(10^(9 * (i + 1)) * 2^120 / 2^(16 * idx)) + 1
+// Both are reduced modulo 10^9 * 2^136, which doesn't change the results of mulShift_mod1e9 for any shift that is
+// used with them. MIN_BLOCK_2[idx] is the number of leading 9-digit blocks after the decimal point that are zero for
+// every double with an exponent in the range for idx.
+
+#include "ryu/ryu_low_level.h"
+#include "ryu/common.h"
+#include "ryu/d2fixed_full_table.h"
+#include "ryu/d2s_intrinsics.h"
+#include "ryu/digit_table.h"
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#define DOUBLE_MANTISSA_BITS 52
+#define DOUBLE_EXPONENT_BITS 11
+#define DOUBLE_BIAS 1023
+
+#define POW10_ADDITIONAL_BITS 120
+
+// Returns v % 10^9 without a 128-bit division.
+static inline uint32_t uint128_mod1e9(const __uint128_t v) {
+    // 2^64 % 10^9 == 709551616
+    const uint64_t hi = (uint64_t)(v >> 64) % 1000000000;
+    return (uint32_t)((hi * 709551616 + (uint64_t)v % 1000000000) % 1000000000);
+}
+
+static inline uint32_t mulShift_mod1e9(const uint64_t m, const uint64_t *const mul, const int32_t j) {
+    const __uint128_t b0 = ((__uint128_t)m) * mul[0]; // 0
+    const __uint128_t b1 = ((__uint128_t)m) * mul[1]; // 64
+    const __uint128_t b2 = ((__uint128_t)m) * mul[2]; // 128
+    assert(j >= 128);
+    assert(j <= 180);
+    const __uint128_t mid = b1 + (uint64_t)(b0 >> 64);  // 64
+    const __uint128_t s1 = b2 + (uint64_t)(mid >> 64); // 128
+    return uint128_mod1e9(s1 >> (j - 128));
+}
+
+// Convert `digits` to a sequence of decimal digits. Append the digits to the result.
+// The caller has to guarantee that:
+//   10^(olength-1) <= digits < 10^olength
+// e.g., by passing `olength` as `decimalLength9(digits)`.
+static inline void append_n_digits(const uint32_t olength, uint32_t digits, char *const result) {
+    uint32_t i = 0;
+    while (digits >= 10000) {
+        const uint32_t c = digits % 10000;
+        digits /= 10000;
+        const uint32_t c0 = (c % 100) << 1;
+        const uint32_t c1 = (c / 100) << 1;
+        __builtin_memcpy(result + olength - i - 2, DIGIT_TABLE + c0, 2);
+        __builtin_memcpy(result + olength - i - 4, DIGIT_TABLE + c1, 2);
+        i += 4;
+    }
+    if (digits >= 100) {
+        const uint32_t c = (digits % 100) << 1;
+        digits /= 100;
+        __builtin_memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
+        i += 2;
+    }
+    if (digits >= 10) {
+        const uint32_t c = digits << 1;
+        __builtin_memcpy(result + olength - i - 2, DIGIT_TABLE + c, 2);
+    } else {
+        result[0] = (char)('0' + digits);
+    }
+}
+
+// Convert `digits` to a sequence of decimal digits. Print the first digit, followed by a decimal
+// dot '.' followed by the remaining digits. The caller has to guarantee that:
+//   10^(olength-1) <= digits < 10^olength
+// e.g., by passing `olength` as `decimalLength9(digits)`.
+static inline void append_d_digits(const uint32_t olength, uint32_t digits, char *const result) {
+    uint32_t i = 0;
+    while (digits >= 10000) {
+        const uint32_t c = digits % 10000;
+        digits /= 10000;
+        const uint32_t c0 = (c % 100) << 1;
+        const uint32_t c1 = (c / 100) << 1;
+        __builtin_memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c0, 2);
+        __builtin_memcpy(result + olength + 1 - i - 4, DIGIT_TABLE + c1, 2);
+        i += 4;
+    }
+    if (digits >= 100) {
+        const uint32_t c = (digits % 100) << 1;
+        digits /= 100;
+        __builtin_memcpy(result + olength + 1 - i - 2, DIGIT_TABLE + c, 2);
+        i += 2;
+    }
+    if (digits >= 10) {
+        const uint32_t c = digits << 1;
+        result[2] = DIGIT_TABLE[c + 1];
+        result[1] = '.';
+        result[0] = DIGIT_TABLE[c];
+    } else {
+        result[1] = '.';
+        result[0] = (char)('0' + digits);
+    }
+}
+
+// Convert `digits` to decimal and write the last `count` decimal digits to result.
+// If `digits` contains additional digits, then those are silently ignored.
+static inline void append_c_digits(const uint32_t count, uint32_t digits, char *const result) {
+    // Copy pairs of digits from DIGIT_TABLE.
+    uint32_t i = 0;
+    for (; i + 1 < count; i += 2) {
+        const uint32_t c = (digits % 100) << 1;
+        digits /= 100;
+        __builtin_memcpy(result + count - i - 2, DIGIT_TABLE + c, 2);
+    }
+    // Generate the last digit if count is odd.
+    if (i < count) {
+        const char c = (char)('0' + (digits % 10));
+        result[count - i - 1] = c;
+    }
+}
+
+// Convert `digits` to decimal and write the last 9 decimal digits to result.
+// If `digits` contains additional digits, then those are silently ignored.
+static inline void append_nine_digits(uint32_t digits, char *const result) {
+    if (digits == 0) {
+        __builtin_memset(result, '0', 9);
+        return;
+    }
+
+    for (uint32_t i = 0; i < 5; i += 4) {
+        const uint32_t c = digits % 10000;
+        digits /= 10000;
+        const uint32_t c0 = (c % 100) << 1;
+        const uint32_t c1 = (c / 100) << 1;
+        __builtin_memcpy(result + 7 - i, DIGIT_TABLE + c0, 2);
+        __builtin_memcpy(result + 5 - i, DIGIT_TABLE + c1, 2);
+    }
+    result[0] = (char)('0' + digits);
+}
+
+static inline uint32_t indexForExponent(const uint32_t e) {
+    return (e + 15) / 16;
+}
+
+static inline uint32_t pow10BitsForIndex(const uint32_t idx) {
+    return 16 * idx + POW10_ADDITIONAL_BITS;
+}
+
+static inline uint32_t lengthForIndex(const uint32_t idx) {
+    // +1 for ceil, +16 for mantissa, +8 to round up when dividing by 9
+    return (log10Pow2(16 * (int32_t)idx) + 1 + 16 + 8) / 9;
+}
+
+// Walks back from the end of the output and rounds it up. roundUp is 1 to round up unconditionally and 2 to round up
+// only if the last digit is odd. Returns true if the carry propagated out of the most significant digit, in which case
+// result[start] is now '1' and all other digits are '0'.
+static bool round_up_digits(char *const result, const int32_t start, const int32_t index, int roundUp) {
+    int32_t roundIndex = index;
+    while (true) {
+        --roundIndex;
+        if (roundIndex < start) {
+            result[start] = '1';
+            return true;
+        }
+        const char c = result[roundIndex];
+        if (c == '.') {
+            continue;
+        } else if (c == '9') {
+            result[roundIndex] = '0';
+            roundUp = 1;
+            continue;
+        } else {
+            if (roundUp == 2 && c % 2 == 0) {
+                return false;
+            }
+            result[roundIndex] = c + 1;
+            return false;
+        }
+    }
+}
+
+static inline bool decompose(const double d, uint64_t *const m2, int32_t *const e2) {
+    const uint64_t bits = double_to_bits(d);
+    const bool ieeeSign = ((bits >> (DOUBLE_MANTISSA_BITS + DOUBLE_EXPONENT_BITS)) & 1) != 0;
+    const uint64_t ieeeMantissa = bits & ((1ull << DOUBLE_MANTISSA_BITS) - 1);
+    const uint32_t ieeeExponent = (uint32_t)((bits >> DOUBLE_MANTISSA_BITS) & ((1u << DOUBLE_EXPONENT_BITS) - 1));
+
+    // Callers handle infinities and NaNs.
+    assert(ieeeExponent != ((1u << DOUBLE_EXPONENT_BITS) - 1u));
+
+    if (ieeeExponent == 0) {
+        *e2 = 1 - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS;
+        *m2 = ieeeMantissa;
+    } else {
+        *e2 = (int32_t)ieeeExponent - DOUBLE_BIAS - DOUBLE_MANTISSA_BITS;
+        *m2 = (1ull << DOUBLE_MANTISSA_BITS) | ieeeMantissa;
+    }
+
+    return ieeeSign;
+}
+
+int d2fixed_buffered_n(double d, uint32_t precision, char *result) {
+    uint64_t m2;
+    int32_t e2;
+    const bool sign = decompose(d, &m2, &e2);
+
+    int index = 0;
+    if (sign) {
+        result[index++] = '-';
+    }
+
+    if (m2 == 0) {
+        result[index++] = '0';
+        if (precision > 0) {
+            result[index++] = '.';
+            __builtin_memset(result + index, '0', precision);
+            index += precision;
+        }
+        return index;
+    }
+
+    const int32_t start = index;
+    bool nonzero = false;
+    if (e2 >= -52) {
+        const uint32_t idx = e2 < 0 ? 0 : indexForExponent((uint32_t)e2);
+        const uint32_t p10bits = pow10BitsForIndex(idx);
+        const int32_t len = (int32_t)lengthForIndex(idx);
+        for (int32_t i = len - 1; i >= 0; --i) {
+            const uint32_t j = p10bits - e2;
+            // Shifting m2 pushes j to 128 or above, which is what mulShift_mod1e9 expects.
+            const uint32_t digits = mulShift_mod1e9(m2 << 8, POW10_SPLIT[POW10_OFFSET[idx] + i], (int32_t)(j + 8));
+            if (nonzero) {
+                append_nine_digits(digits, result + index);
+                index += 9;
+            } else if (digits != 0) {
+                const uint32_t olength = decimalLength9(digits);
+                append_n_digits(olength, digits, result + index);
+                index += olength;
+                nonzero = true;
+            }
+        }
+    }
+    if (!nonzero) {
+        result[index++] = '0';
+    }
+    if (precision > 0) {
+        result[index++] = '.';
+    }
+
+    if (e2 >= 0) {
+        __builtin_memset(result + index, '0', precision);
+        index += precision;
+        return index;
+    }
+
+    const int32_t idx = -e2 / 16;
+    const uint32_t blocks = precision / 9 + 1;
+    // 0 = don't round up; 1 = round up unconditionally; 2 = round up if odd.
+    int roundUp = 0;
+    uint32_t i = 0;
+    if (blocks <= MIN_BLOCK_2[idx]) {
+        i = blocks;
+        __builtin_memset(result + index, '0', precision);
+        index += precision;
+    } else if (i < MIN_BLOCK_2[idx]) {
+        i = MIN_BLOCK_2[idx];
+        __builtin_memset(result + index, '0', 9 * i);
+        index += 9 * i;
+    }
+    for (; i < blocks; ++i) {
+        const int32_t j = ADDITIONAL_BITS_2 + (-e2 - 16 * idx);
+        const uint32_t p = POW10_OFFSET_2[idx] + i - MIN_BLOCK_2[idx];
+        if (p >= POW10_OFFSET_2[idx + 1]) {
+            // All remaining digits are zero, so no rounding is required either.
+            const uint32_t fill = precision - 9 * i;
+            __builtin_memset(result + index, '0', fill);
+            index += fill;
+            break;
+        }
+        uint32_t digits = mulShift_mod1e9(m2 << 8, POW10_SPLIT_2[p], j + 8);
+        if (i < blocks - 1) {
+            append_nine_digits(digits, result + index);
+            index += 9;
+        } else {
+            const uint32_t maximum = precision - 9 * i;
+            uint32_t lastDigit = 0;
+            for (uint32_t k = 0; k < 9 - maximum; ++k) {
+                lastDigit = digits % 10;
+                digits /= 10;
+            }
+            if (lastDigit != 5) {
+                roundUp = lastDigit > 5;
+            } else {
+                // Is m * 10^(additionalDigits + 1) / 2^(-e2) integer?
+                const int32_t requiredTwos = -e2 - (int32_t)precision - 1;
+                const bool trailingZeros =
+                        requiredTwos <= 0 || (requiredTwos < 60 && multipleOfPowerOf2(m2, (uint32_t)requiredTwos));
+                roundUp = trailingZeros ? 2 : 1;
+            }
+            if (maximum > 0) {
+                append_c_digits(maximum, digits, result + index);
+                index += maximum;
+            }
+            break;
+        }
+    }
+
+    if (roundUp != 0 && round_up_digits(result, start, index, roundUp)) {
+        // Every digit was a 9; the first one became a 1, so the whole part needs another digit.
+        int32_t dot = start;
+        while (dot < index && result[dot] != '.') dot++;
+        if (dot < index) {
+            result[dot] = '0';
+            result[dot + 1] = '.';
+        }
+        result[index++] = '0';
+    }
+
+    return index;
+}
+
+int d2exp_buffered_n(double d, uint32_t precision, char *result) {
+    uint64_t m2;
+    int32_t e2;
+    const bool sign = decompose(d, &m2, &e2);
+
+    int index = 0;
+    if (sign) {
+        result[index++] = '-';
+    }
+
+    if (m2 == 0) {
+        result[index++] = '0';
+        if (precision > 0) {
+            result[index++] = '.';
+            __builtin_memset(result + index, '0', precision);
+            index += precision;
+        }
+        __builtin_memcpy(result + index, "e+00", 4);
+        index += 4;
+        return index;
+    }
+
+    const int32_t start = index;
+    const bool printDecimalPoint = precision > 0;
+    ++precision;
+    uint32_t digits = 0;
+    uint32_t printedDigits = 0;
+    uint32_t availableDigits = 0;
+    int32_t exp = 0;
+    if (e2 >= -52) {
+        const uint32_t idx = e2 < 0 ? 0 : indexForExponent((uint32_t)e2);
+        const uint32_t p10bits = pow10BitsForIndex(idx);
+        const int32_t len = (int32_t)lengthForIndex(idx);
+        for (int32_t i = len - 1; i >= 0; --i) {
+            const uint32_t j = p10bits - e2;
+            // Shifting m2 pushes j to 128 or above, which is what mulShift_mod1e9 expects.
+            digits = mulShift_mod1e9(m2 << 8, POW10_SPLIT[POW10_OFFSET[idx] + i], (int32_t)(j + 8));
+            if (printedDigits != 0) {
+                if (printedDigits + 9 > precision) {
+                    availableDigits = 9;
+                    break;
+                }
+                append_nine_digits(digits, result + index);
+                index += 9;
+                printedDigits += 9;
+            } else if (digits != 0) {
+                availableDigits = decimalLength9(digits);
+                exp = i * 9 + (int32_t)availableDigits - 1;
+                if (availableDigits > precision) {
+                    break;
+                }
+                if (printDecimalPoint) {
+                    append_d_digits(availableDigits, digits, result + index);
+                    index += availableDigits + 1; // +1 for decimal point
+                } else {
+                    result[index++] = (char)('0' + digits);
+                }
+                printedDigits = availableDigits;
+                availableDigits = 0;
+            }
+        }
+    }
+
+    if (e2 < 0 && availableDigits == 0) {
+        const int32_t idx = -e2 / 16;
+        for (int32_t i = MIN_BLOCK_2[idx]; i < 200; ++i) {
+            const int32_t j = ADDITIONAL_BITS_2 + (-e2 - 16 * idx);
+            const uint32_t p = POW10_OFFSET_2[idx] + (uint32_t)i - MIN_BLOCK_2[idx];
+            digits = (p >= POW10_OFFSET_2[idx + 1]) ? 0 : mulShift_mod1e9(m2 << 8, POW10_SPLIT_2[p], j + 8);
+            if (printedDigits != 0) {
+                if (printedDigits + 9 > precision) {
+                    availableDigits = 9;
+                    break;
+                }
+                append_nine_digits(digits, result + index);
+                index += 9;
+                printedDigits += 9;
+            } else if (digits != 0) {
+                availableDigits = decimalLength9(digits);
+                exp = -(i + 1) * 9 + (int32_t)availableDigits - 1;
+                if (availableDigits > precision) {
+                    break;
+                }
+                if (printDecimalPoint) {
+                    append_d_digits(availableDigits, digits, result + index);
+                    index += availableDigits + 1; // +1 for decimal point
+                } else {
+                    result[index++] = (char)('0' + digits);
+                }
+                printedDigits = availableDigits;
+                availableDigits = 0;
+            }
+        }
+    }
+
+    const uint32_t maximum = precision - printedDigits;
+    if (availableDigits == 0) {
+        digits = 0;
+    }
+    uint32_t lastDigit = 0;
+    if (availableDigits > maximum) {
+        for (uint32_t k = 0; k < availableDigits - maximum; ++k) {
+            lastDigit = digits % 10;
+            digits /= 10;
+        }
+    }
+    // 0 = don't round up; 1 = round up unconditionally; 2 = round up if odd.
+    int roundUp = 0;
+    if (lastDigit != 5) {
+        roundUp = lastDigit > 5;
+    } else {
+        // Is m * 2^e2 * 10^(precision + 1 - exp) integer?
+        // precision was already increased by 1, so we don't need to write + 1 here.
+        const int32_t rexp = (int32_t)precision - exp;
+        const int32_t requiredTwos = -e2 - rexp;
+        bool trailingZeros = requiredTwos <= 0 || (requiredTwos < 60 && multipleOfPowerOf2(m2, (uint32_t)requiredTwos));
+        if (rexp < 0) {
+            const int32_t requiredFives = -rexp;
+            trailingZeros = trailingZeros && multipleOfPowerOf5(m2, (uint32_t)requiredFives);
+        }
+        roundUp = trailingZeros ? 2 : 1;
+    }
+    if (printedDigits != 0) {
+        if (digits == 0) {
+            __builtin_memset(result + index, '0', maximum);
+        } else {
+            append_c_digits(maximum, digits, result + index);
+        }
+        index += maximum;
+    } else {
+        if (printDecimalPoint) {
+            append_d_digits(maximum, digits, result + index);
+            index += maximum + 1; // +1 for decimal point
+        } else {
+            result[index++] = (char)('0' + digits);
+        }
+    }
+    if (roundUp != 0 && round_up_digits(result, start, index, roundUp)) {
+        ++exp;
+    }
+
+    result[index++] = 'e';
+    if (exp < 0) {
+        result[index++] = '-';
+        exp = -exp;
+    } else {
+        result[index++] = '+';
+    }
+
+    if (exp >= 100) {
+        const int32_t c = exp % 10;
+        __builtin_memcpy(result + index, DIGIT_TABLE + 2 * (exp / 10), 2);
+        result[index + 2] = (char)('0' + c);
+        index += 3;
+    } else {
+        __builtin_memcpy(result + index, DIGIT_TABLE + 2 * exp, 2);
+        index += 2;
+    }
+
+    return index;
+}
@@ -45,6 +45,14 @@ struct floating_decimal {
 struct floating_decimal generic_binary_to_decimal(
     const uint64_t ieeeBits, const uint32_t mantissaBits, const uint32_t exponentBits);
 
+// The same for floats, using only 32- and 64-bit arithmetic.
+struct floating_decimal float_to_decimal(const float f);
+
+// Formats a finite double like printf's %.*f and %.*e with the given precision, rounding exactly. Returns the number
+// of characters written, which is not null terminated.
+int d2fixed_buffered_n(double d, uint32_t precision, char* result);
+int d2exp_buffered_n(double d, uint32_t precision, char* result);
+
 #ifdef __cplusplus
 }
 #endif
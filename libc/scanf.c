@@ -3,34 +3,49 @@
 #include "ctype.h"
 #include "limits.h"
 #include "stdio.h"
+#include "stdio_ext.h"
 #include "stdlib.h"
+#include "string.h"
 #include <stdarg.h>
 #include <stdbool.h>
 #include <stdint.h>
 
 #define BUFFER_SIZE 256
-
-typedef struct {
-    int (*get)(void *ptr);
-    void (*put)(int value, void *ptr); // `value` was returned by the previous call to `get` that hasn't been cancelled
-} scanf_src_t;
-
-typedef struct {
-    scanf_src_t src;
+#define STRING_WINDOW_MIN 64
+#define STRING_WINDOW_MAX 4096
+
+// The input is consumed through a window of contiguous bytes: the string itself for sscanf, and the buffered input of
+// the stream for fscanf. Only when the window runs out does `refill` replace it with the next part of the input.
+typedef struct scanf_ctx {
+    const unsigned char *start;
+    const unsigned char *cur;
+    const unsigned char *end;
+    bool (*refill)(struct scanf_ctx *ctx); // returns false if there's no more input
     void *ptr;
-    int count;
+    int count; // bytes consumed before the current window
 } scanf_ctx_t;
 
+// Moves the window on once everything in it has been consumed.
+static bool next_window(scanf_ctx_t *ctx) {
+    ctx->count += ctx->cur - ctx->start;
+    return ctx->refill(ctx);
+}
+
 static int get(scanf_ctx_t *ctx) {
-    int value = ctx->src.get(ctx->ptr);
-    if (value >= 0) ctx->count += 1;
-    return value;
+    if (ctx->cur == ctx->end && !next_window(ctx)) return EOF;
+    return *ctx->cur++;
 }
 
-static void put(scanf_ctx_t *ctx, int value) {
+// `value` must have been returned by the previous call to `get` that hasn't been cancelled yet. That byte is always
+// still in the window.
+static void put(scanf_ctx_t *ctx, UNUSED int value) {
     assert(value >= 0);
-    ctx->src.put(value, ctx->ptr);
-    ctx->count -= 1;
+    ctx->cur -= 1;
+    assert(*ctx->cur == value);
+}
+
+static int consumed(scanf_ctx_t *ctx) {
+    return ctx->count + (ctx->cur - ctx->start);
 }
 
 static int skipws(scanf_ctx_t *ctx) {
@@ -81,52 +96,207 @@ static int is_valid_digit(unsigned char c, int base) {
     return getdval(c) < base;
 }
 
-static int fill_int_buffer(scanf_ctx_t *ctx, scanf_spec_t *spec, char *buffer, size_t size, int base) {
-    size_t index = 0;
-    int max = spec->width ? spec->width : INT_MAX;
-
-    int value = skipws(ctx);
-    int ret = 1;
+typedef struct {
+    int stage;
+    int base;         // integers only
+    const char *word; // the rest of "infinity" or "nan(" while one of them is being matched
+} item_state_t;
+
+enum {
+    INT_INIT,
+    INT_FIRST,
+    INT_SECOND,
+    INT_DIGITS,
+};
+
+static bool is_int_char(item_state_t *state, unsigned char c) {
+    switch (state->stage) {
+    case INT_INIT:
+        state->stage = INT_FIRST;
+        if (c == '+' || c == '-') return true;
+        // fall through
+    case INT_FIRST: state->stage = INT_SECOND; return is_valid_digit(c, state->base);
+    case INT_SECOND:
+        state->stage = INT_DIGITS;
+        if ((state->base == 0 || state->base == 16) && (c & ~0x20) == 'X') return true;
+        // fall through
+    case INT_DIGITS: return is_valid_digit(c, state->base);
+    default: __builtin_unreachable();
+    }
+}
 
-    if (value == '-' || value == '+') {
-        buffer[index++] = value;
-        value = get(ctx);
-        ret = 0;
+enum {
+    FLOAT_INIT,
+    FLOAT_SIGN,
+    FLOAT_ZERO,
+    FLOAT_WHOLE,
+    FLOAT_FRAC,
+    FLOAT_HEX_WHOLE,
+    FLOAT_HEX_FRAC,
+    FLOAT_EXP_INIT,
+    FLOAT_EXP_DIGITS,
+    FLOAT_WORD,
+    FLOAT_NAN_CHARS,
+    FLOAT_DONE,
+};
+
+// Accepts everything strtod does, so that strtod never continues past the character this stopped at.
+static bool is_float_char(item_state_t *state, unsigned char c) {
+    switch (state->stage) {
+    case FLOAT_INIT:
+        state->stage = FLOAT_SIGN;
+        if (c == '+' || c == '-') return true;
+        // fall through
+    case FLOAT_SIGN:
+        if (c == '0') {
+            state->stage = FLOAT_ZERO;
+            return true;
+        }
+        if ((c | 0x20) == 'i' || (c | 0x20) == 'n') {
+            state->stage = FLOAT_WORD;
+            state->word = (c | 0x20) == 'i' ? "nfinity" : "an(";
+            return true;
+        }
+        if (c == '.') {
+            state->stage = FLOAT_FRAC;
+            return true;
+        }
+        state->stage = FLOAT_WHOLE;
+        return c >= '0' && c <= '9';
+    case FLOAT_ZERO:
+        if ((c & ~0x20) == 'X') {
+            state->stage = FLOAT_HEX_WHOLE;
+            return true;
+        }
+        state->stage = FLOAT_WHOLE;
+        // fall through
+    case FLOAT_WHOLE:
+        if (c == '.') {
+            state->stage = FLOAT_FRAC;
+            return true;
+        }
+        // fall through
+    case FLOAT_FRAC:
+        if ((c & ~0x20) == 'E') {
+            state->stage = FLOAT_EXP_INIT;
+            return true;
+        }
+        return c >= '0' && c <= '9';
+    case FLOAT_HEX_WHOLE:
+        if (c == '.') {
+            state->stage = FLOAT_HEX_FRAC;
+            return true;
+        }
+        // fall through
+    case FLOAT_HEX_FRAC:
+        if ((c & ~0x20) == 'P') {
+            state->stage = FLOAT_EXP_INIT;
+            return true;
+        }
+        return getdval(c) < 16;
+    case FLOAT_EXP_INIT:
+        state->stage = FLOAT_EXP_DIGITS;
+        if (c == '+' || c == '-') return true;
+        // fall through
+    case FLOAT_EXP_DIGITS: return c >= '0' && c <= '9';
+    case FLOAT_WORD:
+        if (*state->word == '(') {
+            state->stage = FLOAT_NAN_CHARS;
+            return c == '(';
+        }
+        return *state->word && (c | 0x20) == *state->word++;
+    case FLOAT_NAN_CHARS:
+        if (c == ')') {
+            state->stage = FLOAT_DONE;
+            return true;
+        }
+        return isalnum(c) || c == '_';
+    case FLOAT_DONE: return false;
+    default: __builtin_unreachable();
     }
+}
 
-    size_t start = index;
+// These return how many of the `length` bytes at `str` continue the item, keeping the state in a local so that it
+// doesn't have to be reloaded for every byte.
+static size_t int_item_length(item_state_t *state, const unsigned char *str, size_t length) {
+    item_state_t cur = *state;
+    size_t i = 0;
+    while (i < length && is_int_char(&cur, str[i])) i++;
+    *state = cur;
+    return i;
+}
 
-    for (;;) {
-        if (value == EOF) break;
+static size_t float_item_length(item_state_t *state, const unsigned char *str, size_t length) {
+    item_state_t cur = *state;
+    size_t i = 0;
+    while (i < length && is_float_char(&cur, str[i])) i++;
+    *state = cur;
+    return i;
+}
 
-        if (((base != 0 && base != 16) || (index - start) != 1 || (value & ~0x20) != 'X') &&
-            !is_valid_digit(value, base)) {
-            put(ctx, value);
-            break;
-        }
+// Reads the longest sequence of at most `spec->width` bytes that `item_length` accepts, after skipping whitespace.
+// Returns zero and points `*item` at the sequence if there is one. The sequence is used in place unless it reaches
+// the end of the window or the field width: the strto* functions only stop at the end of the sequence if they find a
+// byte there that `item_length` rejected. Otherwise it is copied into `buffer` and terminated.
+static int scan_item(
+        scanf_ctx_t *ctx,
+        scanf_spec_t *spec,
+        size_t (*item_length)(item_state_t *, const unsigned char *, size_t),
+        item_state_t *state,
+        char *buffer,
+        const char **item,
+        const char **end
+) {
+    int value = skipws(ctx);
+    if (value == EOF) return EOF;
+    put(ctx, value);
 
-        if (index != size - 1) buffer[index++] = value;
+    const unsigned char *start = ctx->cur;
+    size_t avail = ctx->end - start;
+    size_t max = spec->width ? (size_t)spec->width : SIZE_MAX;
+    size_t length = item_length(state, start, avail < max ? avail : max);
+    ctx->cur += length;
 
-        ret = 0;
-        if (--max == 0) break;
+    if (length < avail && length < max) {
+        if (length == 0) return 1;
 
-        value = get(ctx);
+        *item = (const char *)start;
+        *end = (const char *)ctx->cur;
+        return 0;
+    }
+
+    size_t index = length < BUFFER_SIZE - 1 ? length : BUFFER_SIZE - 1;
+    __builtin_memcpy(buffer, start, index);
+
+    // Only a window that was used up can be followed by more of the item
+    while (length < max && ctx->cur == ctx->end && next_window(ctx)) {
+        avail = ctx->end - ctx->cur;
+        size_t count = item_length(state, ctx->cur, avail < max - length ? avail : max - length);
+        size_t copy = count < BUFFER_SIZE - 1 - index ? count : BUFFER_SIZE - 1 - index;
+
+        __builtin_memcpy(buffer + index, ctx->cur, copy);
+        index += copy;
+        ctx->cur += count;
+        length += count;
     }
-    if (ret) return ret;
 
     buffer[index] = 0;
+    *item = buffer;
+    *end = buffer + index;
     return 0;
 }
 
 static int match_signed_int(scanf_ctx_t *ctx, scanf_spec_t *spec, intmax_t *out, int base) {
     char buffer[BUFFER_SIZE];
-    int ret = fill_int_buffer(ctx, spec, buffer, sizeof(buffer), base);
+    const char *item, *item_end;
+    item_state_t state = {INT_INIT, base, NULL};
+    int ret = scan_item(ctx, spec, int_item_length, &state, buffer, &item, &item_end);
     if (ret) return ret;
 
     char *end;
-    long value = strtol(buffer, &end, base);
+    long value = strtol(item, &end, base);
     if (out) *out = value;
-    return *end != 0;
+    return end != item_end;
 }
 
 static int match_SDEC(scanf_ctx_t *ctx, scanf_spec_t *spec, intmax_t *out) {
@@ -139,13 +309,15 @@ static int match_SINT(scanf_ctx_t *ctx, scanf_spec_t *spec, intmax_t *out) {
 
 static int match_unsigned_int(scanf_ctx_t *ctx, scanf_spec_t *spec, uintmax_t *out, int base) {
     char buffer[BUFFER_SIZE];
-    int ret = fill_int_buffer(ctx, spec, buffer, sizeof(buffer), base);
+    const char *item, *item_end;
+    item_state_t state = {INT_INIT, base, NULL};
+    int ret = scan_item(ctx, spec, int_item_length, &state, buffer, &item, &item_end);
     if (ret) return ret;
 
     char *end;
-    unsigned long value = strtoul(buffer, &end, base);
+    unsigned long value = strtoul(item, &end, base);
     if (out) *out = value;
-    return *end != 0;
+    return end != item_end;
 }
 
 static int match_UOCT(scanf_ctx_t *ctx, scanf_spec_t *spec, uintmax_t *out) {
@@ -160,145 +332,117 @@ static int match_UHEX(scanf_ctx_t *ctx, scanf_spec_t *spec, uintmax_t *out) {
     return match_unsigned_int(ctx, spec, out, 16);
 }
 
-typedef enum {
-    FLOAT_INIT,
-    FLOAT_WHOLE,
-    FLOAT_FRAC,
-    FLOAT_EXP_INIT,
-    FLOAT_EXP_DIGITS,
-} float_state_t;
-
-static bool is_valid_float_char(float_state_t *state, unsigned char c) {
-    float_state_t cur = *state;
+static int match_FLOAT(scanf_ctx_t *ctx, scanf_spec_t *spec, double *out) {
+    char buffer[BUFFER_SIZE];
+    const char *item, *item_end;
+    item_state_t state = {FLOAT_INIT, 0, NULL};
+    int ret = scan_item(ctx, spec, float_item_length, &state, buffer, &item, &item_end);
+    if (ret) return ret;
 
-    switch (cur) {
-    case FLOAT_INIT:
-        *state = FLOAT_WHOLE;
-        if (c == '+' || c == '-') return true;
-        // fall through
-    case FLOAT_WHOLE:
-        if (c == '.') {
-            *state = FLOAT_FRAC;
-            return true;
-        }
-        // fall through
-    case FLOAT_FRAC:
-        if ((c & ~0x20) == 'E') {
-            *state = FLOAT_EXP_INIT;
-            return true;
-        }
-        return c >= '0' && c <= '9';
-    case FLOAT_EXP_INIT:
-        *state = FLOAT_EXP_DIGITS;
-        if (c == '+' || c == '-') return true;
-        // fall through
-    case FLOAT_EXP_DIGITS: return c >= '0' && c <= '9';
-    default: __builtin_unreachable();
-    }
+    char *end;
+    double value = strtod(item, &end);
+    if (out) *out = value;
+    return end != item_end;
 }
 
-static int fill_float_buffer(scanf_ctx_t *ctx, scanf_spec_t *spec, char *buffer, size_t size) {
-    size_t index = 0;
-    int max = spec->width ? spec->width : INT_MAX;
+// A set of bytes, with one bit per byte value.
+typedef struct {
+    uint8_t bits[32];
+} byte_set_t;
+
+// Every byte except whitespace, which is what %s accepts.
+static const byte_set_t non_space_set = {{
+        0xff, 0xc1, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+        0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+}};
 
-    int value = skipws(ctx);
-    int ret = 1;
-    float_state_t state = FLOAT_INIT;
+static bool in_set(const byte_set_t *set, unsigned char c) {
+    return (set->bits[c >> 3] >> (c & 7)) & 1;
+}
 
-    for (;;) {
-        if (value == EOF) break;
+// Consumes bytes that are in the set until one isn't or `spec->width` of them have been consumed, moving on to the
+// next window whenever the current one is used up. They are copied into `buffer` unless it is NULL. Returns whether
+// any bytes were consumed, or EOF if the input ended before any of them.
+static int take_set(scanf_ctx_t *ctx, scanf_spec_t *spec, unsigned char *buffer, const byte_set_t *set) {
+    size_t max = spec->width ? (size_t)spec->width : SIZE_MAX;
+    size_t length = 0;
 
-        if (!is_valid_float_char(&state, value)) {
-            put(ctx, value);
+    while (length < max) {
+        if (ctx->cur == ctx->end && !next_window(ctx)) {
+            if (length == 0) return EOF;
             break;
         }
 
-        if (index != size - 1) buffer[index++] = value;
+        const unsigned char *start = ctx->cur;
+        size_t avail = ctx->end - start;
+        size_t limit = avail < max - length ? avail : max - length;
+        size_t count = 0;
 
-        ret = 0;
-        if (--max == 0) break;
+        while (count < limit && in_set(set, start[count])) count++;
 
-        value = get(ctx);
-    }
-    if (ret) return ret;
-
-    buffer[index] = 0;
-    return 0;
-}
+        if (buffer) {
+            __builtin_memcpy(buffer, start, count);
+            buffer += count;
+        }
 
-static int match_FLOAT(scanf_ctx_t *ctx, scanf_spec_t *spec, double *out) {
-    char buffer[BUFFER_SIZE];
-    int ret = fill_float_buffer(ctx, spec, buffer, sizeof(buffer));
-    if (ret) return ret;
+        ctx->cur += count;
+        length += count;
+        if (count < avail) break;
+    }
 
-    char *end;
-    double value = strtod(buffer, &end);
-    if (out) *out = value;
-    return *end != 0;
+    if (buffer) *buffer = 0;
+    return length != 0;
 }
 
 static int match_STRING(scanf_ctx_t *ctx, scanf_spec_t *spec, unsigned char *buffer) {
-    int max = spec->width ? spec->width : INT_MAX;
-
     int value = skipws(ctx);
-    int ret = 1;
-
-    for (;;) {
-        if (value == EOF) break;
-
-        if (isspace(value)) {
-            put(ctx, value);
-            break;
-        }
+    if (value == EOF) return EOF;
+    put(ctx, value);
 
-        *buffer++ = value;
-        ret = 0;
-        if (--max == 0) break;
-
-        value = get(ctx);
-    }
-
-    *buffer = 0;
-    return ret;
+    take_set(ctx, spec, buffer, &non_space_set);
+    return 0;
 }
 
 static int match_SCANSET(
         scanf_ctx_t *ctx,
         scanf_spec_t *spec,
         unsigned char *buffer,
-        const void *set,
+        const void *chars,
         size_t count,
         bool negate
 ) {
-    unsigned char *start = buffer;
-    int max = spec->width ? spec->width : INT_MAX;
+    byte_set_t set;
+    __builtin_memset(&set, negate ? 0xff : 0, sizeof(set));
 
-    for (int i = 0; i < max; i++) {
-        int value = get(ctx);
-        if (value == EOF) break;
+    for (const unsigned char *cur = chars; count > 0; cur++, count--) {
+        uint8_t bit = 1 << (*cur & 7);
 
-        if (!!__builtin_memchr(set, value, count) == !!negate) {
-            put(ctx, value);
-            break;
-        }
-        *buffer++ = value;
+        if (!negate) set.bits[*cur >> 3] |= bit;
+        else set.bits[*cur >> 3] &= ~bit;
     }
 
-    *buffer = 0;
-    return start == buffer;
+    int ret = take_set(ctx, spec, buffer, &set);
+    return ret == EOF ? EOF : ret == 0;
 }
 
 static int match_CHARS(scanf_ctx_t *ctx, scanf_spec_t *spec, unsigned char *buffer) {
-    int count = spec->width ? spec->width : 1;
+    size_t count = spec->width ? (size_t)spec->width : 1;
+    size_t length = 0;
 
-    int i;
-    for (i = 0; i < count; i++) {
-        int value = get(ctx);
-        if (value == EOF) break;
-        if (buffer) *buffer++ = value;
+    while (length < count && (ctx->cur != ctx->end || next_window(ctx))) {
+        size_t avail = ctx->end - ctx->cur;
+        size_t copy = avail < count - length ? avail : count - length;
+
+        if (buffer) {
+            __builtin_memcpy(buffer, ctx->cur, copy);
+            buffer += copy;
+        }
+
+        ctx->cur += copy;
+        length += copy;
     }
 
-    return i == 0;
+    return length != 0 ? 0 : EOF;
 }
 
 static int match_POINTER(scanf_ctx_t *ctx, scanf_spec_t *spec, void **out) {
@@ -306,7 +450,7 @@ static int match_POINTER(scanf_ctx_t *ctx, scanf_spec_t *spec, void **out) {
     int ret = match_UHEX(ctx, spec, &value);
     if (ret) return ret;
 
-    *out = (void *)value;
+    if (out) *out = (void *)value;
     return 0;
 }
 
@@ -355,7 +499,7 @@ static int parse_conv_spec(const char *format, scanf_spec_t *out) {
 
 #define CONVERT(name, out)                                                                                             \
     do {                                                                                                               \
-        int ret = match_##name(&ctx, &spec, out);                                                                      \
+        int ret = match_##name(ctx, &spec, out);                                                                       \
         if (ret == EOF) goto err;                                                                                      \
         if (ret) goto done;                                                                                            \
     } while (0)
@@ -396,8 +540,7 @@ static bool is_format_ws(char c) {
     return c == '\r' || c == '\n' || c == '\t' || c == ' ';
 }
 
-static int do_scanf(scanf_src_t src, void *ptr, const char *format, va_list args) {
-    scanf_ctx_t ctx = {src, ptr, 0};
+static int do_scanf(scanf_ctx_t *ctx, const char *format, va_list args) {
     int count = 0;
     int conversions = 0;
 
@@ -433,7 +576,7 @@ static int do_scanf(scanf_src_t src, void *ptr, const char *format, va_list args
                     } while (*format != ']');
 
                     int ret = match_SCANSET(
-                            &ctx,
+                            ctx,
                             &spec,
                             !spec.no_assign ? va_arg(args, unsigned char *) : NULL,
                             start,
@@ -449,19 +592,19 @@ static int do_scanf(scanf_src_t src, void *ptr, const char *format, va_list args
                 case CONV_WRITEBACK:
                     switch (spec.length) {
                     case LEN_LONG_DOUBLE:
-                    case LEN_DEFAULT: *va_arg(args, int *) = ctx.count; break;
-                    case LEN_SHORT: *va_arg(args, short *) = ctx.count; break;
-                    case LEN_LONG: *va_arg(args, long *) = ctx.count; break;
+                    case LEN_DEFAULT: *va_arg(args, int *) = consumed(ctx); break;
+                    case LEN_SHORT: *va_arg(args, short *) = consumed(ctx); break;
+                    case LEN_LONG: *va_arg(args, long *) = consumed(ctx); break;
                     }
                     continue; // skip incrementing count and conversions
                 case CONV_PERCENT: {
-                    int value = skipws(&ctx);
+                    int value = skipws(ctx);
                     if (value == EOF) goto err;
                     if (value != '%') {
-                        put(&ctx, value);
+                        put(ctx, value);
                         goto done;
                     }
-                    break;
+                    continue; // a literal %, not a conversion
                 }
                 }
 
@@ -470,17 +613,17 @@ static int do_scanf(scanf_src_t src, void *ptr, const char *format, va_list args
                 continue;
             }
         } else if (is_format_ws(c)) {
-            int value = skipws(&ctx);
-            if (value == EOF) goto err;
-            put(&ctx, value);
+            // this can't fail, not even at the end of the input
+            int value = skipws(ctx);
+            if (value != EOF) put(ctx, value);
             while (is_format_ws(format[1])) format++;
             continue;
         }
 
-        int value = get(&ctx);
+        int value = get(ctx);
         if (value == EOF) goto err;
         if (value != c) {
-            put(&ctx, value);
+            put(ctx, value);
             break;
         }
     }
@@ -491,17 +634,30 @@ err:
     return conversions ? count : EOF;
 }
 
-static int scanf_file_get(void *ptr) {
-    return fgetc(ptr);
-}
+// The window of a stream is its buffered input, and whatever has been consumed from it is only handed back to the
+// stream when the window moves on or when scanning is done.
+static bool scanf_file_refill(scanf_ctx_t *ctx) {
+    FILE *stream = ctx->ptr;
+    __freadptrinc(stream, ctx->cur - ctx->start);
+
+    size_t size;
+    const char *view = __freadptr(stream, &size);
+    if (!view) {
+        ctx->start = ctx->cur;
+        return false;
+    }
 
-static void scanf_file_put(int value, void *ptr) {
-    UNUSED int ret = ungetc(value, ptr);
-    assert(ret == value);
+    ctx->start = (const unsigned char *)view;
+    ctx->cur = ctx->start;
+    ctx->end = ctx->start + size;
+    return true;
 }
 
 static int vfscanf(FILE *restrict stream, const char *restrict format, va_list args) {
-    return do_scanf((scanf_src_t){scanf_file_get, scanf_file_put}, stream, format, args);
+    scanf_ctx_t ctx = {NULL, NULL, NULL, scanf_file_refill, stream, 0};
+    int ret = do_scanf(&ctx, format, args);
+    __freadptrinc(stream, ctx.cur - ctx.start);
+    return ret;
 }
 
 EXPORT int fscanf(FILE *restrict stream, const char *restrict format, ...) {
@@ -520,34 +676,26 @@ EXPORT int scanf(const char *restrict format, ...) {
     return ret;
 }
 
-typedef struct {
-    const char *cur;
-} scanf_str_ctx_t;
-
-static int scanf_str_get(void *ptr) {
-    scanf_str_ctx_t *ctx = ptr;
-    unsigned char c = *ctx->cur;
-
-    if (c) {
-        ctx->cur++;
-        return c;
-    } else {
-        return EOF;
-    }
-}
-
-static void scanf_str_put(UNUSED int value, void *ptr) {
-    scanf_str_ctx_t *ctx = ptr;
-    ctx->cur -= 1;
-    assert((unsigned char)*ctx->cur == value);
+// The window starts small and doubles with every refill instead of covering the whole string right away, since
+// finding the end of the string first would make scanning a few bytes at the start of a long string as slow as
+// scanning all of it.
+static bool scanf_str_refill(scanf_ctx_t *ctx) {
+    size_t size = ctx->end - (const unsigned char *)ctx->ptr;
+    if (size < STRING_WINDOW_MIN) size = STRING_WINDOW_MIN;
+    if (size > STRING_WINDOW_MAX) size = STRING_WINDOW_MAX;
+
+    ctx->start = ctx->cur;
+    ctx->end += strnlen((const char *)ctx->end, size);
+    return ctx->cur != ctx->end;
 }
 
 EXPORT int sscanf(const char *restrict s, const char *restrict format, ...) {
-    scanf_str_ctx_t ctx = {s};
+    const unsigned char *str = (const unsigned char *)s;
+    scanf_ctx_t ctx = {str, str, str, scanf_str_refill, (void *)str, 0};
 
     va_list args;
     va_start(args, format);
-    int ret = do_scanf((scanf_src_t){scanf_str_get, scanf_str_put}, &ctx, format, args);
+    int ret = do_scanf(&ctx, format, args);
     va_end(args);
 
     return ret;
@@ -6,15 +6,77 @@
 #include "stdlib.h"
 #include "string.h"
 #include <hydrogen/fcntl.h>
+#include <hydrogen/memory.h>
 #include <hydrogen/vfs.h>
+#include <stdbool.h>
+#include <stdint.h>
 
 #define STREAM_EOF (1 << 0)
 #define STREAM_ERR (1 << 1)
+#define STREAM_OWN_BUF (1 << 2)   // __buf was allocated by us and must be freed
+#define STREAM_PROBE_TTY (1 << 3) // line buffered if the descriptor is interactive, fully buffered otherwise
+#define STREAM_MAPPED (1 << 4)    // __buf is a read-only mapping of the whole file
+#define STREAM_APPEND (1 << 5)    // writes move the backend to the end first, so __offset is lost after each write
+#define STREAM_UNGETC (1 << 6)    // the input buffer contains pushed back bytes that aren't in the file
+
+#define UNGET_SIZE 16
+
+_Static_assert(sizeof(((FILE *)0)->__small_buf) == UNGET_SIZE + 1, "__small_buf has the wrong size");
+
+#define POOL_CHUNK_SIZE 16
+
+// The backend of a stream. Everything above it (buffering, ungetc, formatting) is shared by all backends.
+struct __stream_ops {
+    hydrogen_io_res_t (*read)(FILE *stream, void *buffer, size_t size);
+    hydrogen_io_res_t (*write)(FILE *stream, const void *buffer, size_t size);
+    int (*seek)(FILE *stream, uint64_t *offset, hydrogen_whence_t whence);
+    int (*close)(FILE *stream);
+};
 
 EXPORT FILE *stdin;
 EXPORT FILE *stdout;
 EXPORT FILE *stderr;
 
+static FILE std_streams[3];
+static FILE *open_streams;
+static FILE *free_streams;
+
+// FILE objects are taken from a pool that is refilled a chunk at a time and never shrinks.
+static FILE *alloc_stream(void) {
+    if (!free_streams) {
+        FILE *chunk = malloc(sizeof(*chunk) * POOL_CHUNK_SIZE);
+        if (!chunk) return NULL;
+
+        for (size_t i = 0; i < POOL_CHUNK_SIZE; i++) {
+            chunk[i].__next = free_streams;
+            free_streams = &chunk[i];
+        }
+    }
+
+    FILE *stream = free_streams;
+    free_streams = stream->__next;
+    return stream;
+}
+
+static void free_stream(FILE *stream) {
+    stream->__next = free_streams;
+    free_streams = stream;
+}
+
+static void register_stream(FILE *stream) {
+    stream->__prev = NULL;
+    stream->__next = open_streams;
+    if (open_streams) open_streams->__prev = stream;
+    open_streams = stream;
+}
+
+static void unregister_stream(FILE *stream) {
+    if (stream->__prev) stream->__prev->__next = stream->__next;
+    else open_streams = stream->__next;
+
+    if (stream->__next) stream->__next->__prev = stream->__prev;
+}
+
 EXPORT int remove(const char *filename) {
     int error = hydrogen_unlink(-1, filename, __builtin_strlen(filename), false);
     if (error) {
@@ -35,11 +97,250 @@ EXPORT int rename(const char *oldname, const char *newname) {
     return 0;
 }
 
-static void openfd(FILE *stream, int fd) {
+static void open_stream(FILE *stream, const struct __stream_ops *ops, void *cookie) {
     __builtin_memset(stream, 0, sizeof(*stream));
+    stream->__ops = ops;
+    stream->__cookie = cookie;
+    stream->__offset = -1;
+    stream->__fd = -1;
+    stream->__mode = _IOFBF;
+    register_stream(stream);
+}
+
+static hydrogen_io_res_t fd_read(FILE *stream, void *buffer, size_t size) {
+    return hydrogen_read(stream->__fd, buffer, size);
+}
+
+static hydrogen_io_res_t fd_write(FILE *stream, const void *buffer, size_t size) {
+    return hydrogen_write(stream->__fd, buffer, size);
+}
+
+static int fd_seek(FILE *stream, uint64_t *offset, hydrogen_whence_t whence) {
+    return hydrogen_seek(stream->__fd, offset, whence);
+}
+
+static int fd_close(FILE *stream) {
+    return hydrogen_close(stream->__fd);
+}
+
+static const struct __stream_ops fd_ops = {
+        .read = fd_read,
+        .write = fd_write,
+        .seek = fd_seek,
+        .close = fd_close,
+};
+
+static void openfd(FILE *stream, int fd) {
+    open_stream(stream, &fd_ops, NULL);
     stream->__fd = fd;
 }
 
+// Hydrogen has no way to ask whether a descriptor refers to a terminal. Terminals and pipes can't seek, so treat
+// every unseekable stream as interactive; at worst that makes a pipe line buffered.
+static bool is_interactive(FILE *stream) {
+    uint64_t offset = 0;
+    return stream->__ops->seek(stream, &offset, HYDROGEN_WHENCE_CUR) != 0;
+}
+
+static void setup_buffer(FILE *stream) {
+    if (stream->__flags & STREAM_PROBE_TTY) {
+        stream->__mode = is_interactive(stream) ? _IOLBF : _IOFBF;
+        stream->__flags &= ~STREAM_PROBE_TTY;
+    }
+
+    if (stream->__mode != _IONBF) {
+        size_t size = stream->__buf_size ? stream->__buf_size : BUFSIZ;
+        unsigned char *buffer = malloc(UNGET_SIZE + size);
+
+        if (buffer) {
+            stream->__buf = buffer + UNGET_SIZE;
+            stream->__buf_size = size;
+            stream->__flags |= STREAM_OWN_BUF;
+            return;
+        }
+
+        stream->__mode = _IONBF;
+    }
+
+    stream->__buf = stream->__small_buf + UNGET_SIZE;
+    stream->__buf_size = 0;
+}
+
+static void free_buffer(FILE *stream) {
+    if (stream->__flags & STREAM_OWN_BUF) {
+        free(stream->__buf - UNGET_SIZE);
+        stream->__flags &= ~STREAM_OWN_BUF;
+    }
+
+    if (stream->__flags & STREAM_MAPPED) {
+        hydrogen_unmap_memory((uintptr_t)stream->__buf, stream->__buf_size);
+        stream->__flags &= ~STREAM_MAPPED;
+    }
+
+    stream->__buf = NULL;
+    stream->__buf_size = 0;
+}
+
+// Keeps track of the backend position after it transferred `count` bytes.
+static void advance(FILE *stream, size_t count) {
+    if (stream->__offset >= 0) stream->__offset += count;
+}
+
+static int seek_backend(FILE *stream, int64_t offset, hydrogen_whence_t whence) {
+    uint64_t off = offset;
+    int error = stream->__ops->seek(stream, &off, whence);
+    stream->__offset = error ? -1 : (long)off;
+    return error;
+}
+
+static size_t write_all(FILE *stream, const void *data, size_t size) {
+    size_t total = 0;
+
+    while (total < size) {
+        hydrogen_io_res_t res = stream->__ops->write(stream, data + total, size - total);
+        if (res.error || res.transferred == 0) {
+            if (res.error) errno = res.error;
+            stream->__flags |= STREAM_ERR;
+            break;
+        }
+
+        total += res.transferred;
+    }
+
+    if (stream->__flags & STREAM_APPEND) stream->__offset = -1;
+    else advance(stream, total);
+
+    return total;
+}
+
+// Writes out the buffered output. The buffer is emptied even if that fails.
+static bool flush_write(FILE *stream) {
+    size_t pending = stream->__wpos - stream->__buf;
+    stream->__wpos = stream->__buf;
+    return write_all(stream, stream->__buf, pending) == pending;
+}
+
+// Drops the buffered input, moving the backend's position back to the stream's logical position.
+static void drop_read(FILE *stream) {
+    int64_t unread = stream->__rend - stream->__rpos;
+    if (unread) seek_backend(stream, -unread, HYDROGEN_WHENCE_CUR); // discard error, the stream might not be seekable
+
+    stream->__rpos = NULL;
+    stream->__rend = NULL;
+    stream->__flags &= ~STREAM_UNGETC;
+}
+
+// Puts the stream into the idle state, where it has neither buffered input nor buffered output.
+static bool make_idle(FILE *stream) {
+    bool ok = true;
+
+    if (stream->__wpos) {
+        ok = flush_write(stream);
+        stream->__wpos = NULL;
+        stream->__wend = NULL;
+    }
+
+    if (stream->__rpos) drop_read(stream);
+
+    return ok;
+}
+
+static bool to_read(FILE *stream) {
+    if (stream->__rpos) return true;
+    if (!stream->__buf) setup_buffer(stream);
+    if (!make_idle(stream)) return false;
+
+    stream->__rpos = stream->__buf;
+    stream->__rend = stream->__buf;
+    return true;
+}
+
+static void to_write(FILE *stream) {
+    if (stream->__wpos) return;
+    if (!stream->__buf) setup_buffer(stream);
+    make_idle(stream);
+
+    // The mapping of a mapped stream can't be written to, so every write goes straight to the descriptor
+    bool buffered = stream->__mode != _IONBF && !(stream->__flags & STREAM_MAPPED);
+
+    stream->__wpos = stream->__buf;
+    stream->__wend = stream->__buf + (buffered ? stream->__buf_size : 0);
+}
+
+static void flush_line_buffered(void) {
+    for (FILE *cur = open_streams; cur != NULL; cur = cur->__next) {
+        if (cur->__mode == _IOLBF && cur->__wpos && cur->__wpos != cur->__buf) {
+            flush_write(cur);
+        }
+    }
+}
+
+// While the input buffer of a mapped stream is in use, it covers everything from the logical position to the end of
+// the file, and the descriptor is positioned at the end of the file. Dropping the buffer moves the descriptor back
+// like for any other stream, so refilling just has to map that position back into the file.
+static bool refill_mapped(FILE *stream) {
+    if (stream->__offset < 0) {
+        int error = seek_backend(stream, 0, HYDROGEN_WHENCE_CUR);
+        if (error) {
+            errno = error;
+            stream->__flags |= STREAM_ERR;
+            return false;
+        }
+    }
+
+    uint64_t offset = stream->__offset;
+
+    if (offset >= stream->__buf_size) {
+        stream->__flags |= STREAM_EOF;
+        return false;
+    }
+
+    int error = seek_backend(stream, stream->__buf_size, HYDROGEN_WHENCE_SET);
+    if (error) {
+        errno = error;
+        stream->__flags |= STREAM_ERR;
+        return false;
+    }
+
+    stream->__rpos = stream->__buf + offset;
+    stream->__rend = stream->__buf + stream->__buf_size;
+    stream->__flags &= ~STREAM_UNGETC;
+    return true;
+}
+
+// Refills the input buffer of a stream that has no buffered input left.
+static bool refill(FILE *stream) {
+    if (stream->__flags & STREAM_EOF) return false;
+    if (stream->__flags & STREAM_MAPPED) return refill_mapped(stream);
+
+    // Input from an unbuffered or line buffered stream may have to wait for the user, who should see any prompts
+    // that haven't been written out yet.
+    if (stream->__mode != _IOFBF) flush_line_buffered();
+
+    hydrogen_io_res_t res = stream->__ops->read(
+            stream,
+            stream->__buf,
+            stream->__mode != _IONBF ? stream->__buf_size : 1
+    );
+    stream->__rpos = stream->__buf;
+    stream->__rend = stream->__buf + res.transferred;
+    stream->__flags &= ~STREAM_UNGETC;
+    advance(stream, res.transferred);
+
+    if (res.error) {
+        errno = res.error;
+        stream->__flags |= STREAM_ERR;
+        return false;
+    }
+
+    if (!res.transferred) {
+        stream->__flags |= STREAM_EOF;
+        return false;
+    }
+
+    return true;
+}
+
 static void generate_temp_name(char *buffer) {
     __builtin_memcpy(buffer, "/tmp/tmp.", 9);
 
@@ -55,7 +356,7 @@ static void generate_temp_name(char *buffer) {
 EXPORT FILE *tmpfile(void) {
     char buffer[L_tmpnam];
 
-    FILE *stream = malloc(sizeof(*stream));
+    FILE *stream = alloc_stream();
     if (!stream) return stream;
 
     for (;;) {
@@ -65,11 +366,12 @@ EXPORT FILE *tmpfile(void) {
         if (fd < 0) {
             if (fd == -ERR_NOT_FOUND) continue;
             errno = -fd;
-            free(stream);
+            free_stream(stream);
             return NULL;
         }
 
         openfd(stream, fd);
+        stream->__flags |= STREAM_APPEND;
         return stream;
     }
 }
@@ -91,38 +393,65 @@ EXPORT char *tmpnam(char *s) {
     }
 }
 
-static FILE *open_init_stream(int fd) {
-    FILE *stream = malloc(sizeof(*stream));
-    if (!stream) abort();
+static FILE *open_init_stream(int fd, int mode) {
+    FILE *stream = &std_streams[fd];
     openfd(stream, fd);
+    stream->__mode = mode;
     return stream;
 }
 
 void init_stdio(void) {
-    stdin = open_init_stream(0);
-    stdout = open_init_stream(1);
-    stderr = open_init_stream(2);
+    stdin = open_init_stream(0, _IOFBF);
+    stdout = open_init_stream(1, _IOFBF);
+    stderr = open_init_stream(2, _IONBF);
+
+    stdin->__flags |= STREAM_PROBE_TTY;
+    stdout->__flags |= STREAM_PROBE_TTY;
+}
+
+void exit_stdio(void) {
+    // Nothing can use the streams after this, so there's no need to keep the bookkeeping consistent
+    for (FILE *cur = open_streams; cur != NULL; cur = cur->__next) {
+        if (cur->__wpos) flush_write(cur);
+        cur->__ops->close(cur);
+    }
+
+    open_streams = NULL;
 }
 
 static int do_close(FILE *stream) {
-    int error = hydrogen_close(stream->__fd);
+    unregister_stream(stream);
+
+    int ret = make_idle(stream) ? 0 : EOF;
+    free_buffer(stream);
 
-    if (!error) {
-        return 0;
-    } else {
+    int error = stream->__ops->close(stream);
+    if (error) {
         errno = error;
-        return EOF;
+        ret = EOF;
     }
+
+    return ret;
 }
 
 EXPORT int fclose(FILE *stream) {
     int error = do_close(stream);
-    __builtin_free(stream);
+    free_stream(stream);
     return error;
 }
 
-EXPORT int fflush(UNUSED FILE *stream) {
-    return 0;
+EXPORT int fflush(FILE *stream) {
+    if (!stream) {
+        int ret = 0;
+
+        for (FILE *cur = open_streams; cur != NULL; cur = cur->__next) {
+            if (cur->__wpos && !flush_write(cur)) ret = EOF;
+        }
+
+        return ret;
+    }
+
+    return make_idle(stream) ? 0 : EOF;
 }
 
 static int mode_to_flags(const char *mode) {
@@ -136,28 +465,53 @@ static int mode_to_flags(const char *mode) {
         }
 
         if (mode[1]) {
-            if (mode[1] == '+' || mode[2] == '+') flags |= O_WRONLY;
+            if (mode[1] == '+' || mode[2] == '+') flags |= O_RDONLY | O_WRONLY;
         }
     }
 
     return flags;
 }
 
+// Makes the stream read from a mapping of the whole file instead of a buffer. If the file can't be mapped, the
+// stream is left as a normal buffered stream.
+static void map_stream(FILE *stream) {
+    uint64_t size = 0;
+    if (hydrogen_seek(stream->__fd, &size, HYDROGEN_WHENCE_END) || size == 0) goto fail;
+
+    intptr_t addr = hydrogen_map_memory(0, size, VMM_PRIVATE | VMM_READ, stream->__fd, 0);
+    if (addr < 0) goto fail;
+
+    // The descriptor is already at the end of the file, so the whole file can be handed out as buffered input
+    stream->__buf = (unsigned char *)addr;
+    stream->__buf_size = size;
+    stream->__rpos = stream->__buf;
+    stream->__rend = stream->__buf + size;
+    stream->__offset = size;
+    stream->__flags |= STREAM_MAPPED;
+    return;
+fail:
+    seek_backend(stream, 0, HYDROGEN_WHENCE_SET);
+}
+
 static FILE *open_into(FILE *stream, const char *filename, const char *mode) {
     int flags = mode_to_flags(mode);
     int fd = hydrogen_open(-1, filename, __builtin_strlen(filename), flags, 0666);
     if (fd < 0) {
         errno = -fd;
-        free(stream);
+        free_stream(stream);
         return NULL;
     }
 
     openfd(stream, fd);
+    if (flags & O_APPEND) stream->__flags |= STREAM_APPEND;
+
+    if (mode[0] == 'r' && !(flags & O_WRONLY) && __builtin_strchr(mode, 'm')) map_stream(stream);
+
     return stream;
 }
 
 EXPORT FILE *fopen(const char *restrict filename, const char *restrict mode) {
-    FILE *stream = malloc(sizeof(*stream));
+    FILE *stream = alloc_stream();
     if (!stream) return NULL;
 
     return open_into(stream, filename, mode);
@@ -168,43 +522,534 @@ EXPORT FILE *freopen(const char *restrict filename, const char *restrict mode, F
     return open_into(stream, filename, mode);
 }
 
+typedef struct {
+    unsigned char *buffer;
+    size_t size;     // capacity of the buffer
+    size_t length;   // end of the data written so far
+    size_t position;
+    int flags;       // O_RDONLY, O_WRONLY, O_APPEND
+    bool own_buffer;
+} mem_stream_t;
+
+// Computes the new position of a seek on a memory stream whose data is `length` bytes long
+static int mem_seek_to(uint64_t *offset, hydrogen_whence_t whence, size_t position, size_t length, size_t limit) {
+    uint64_t base;
+
+    switch (whence) {
+    case HYDROGEN_WHENCE_SET: base = 0; break;
+    case HYDROGEN_WHENCE_CUR: base = position; break;
+    case HYDROGEN_WHENCE_END: base = length; break;
+    default: return __EINVAL;
+    }
+
+    uint64_t target = base + *offset;
+    if ((int64_t)*offset < 0 ? target > base : (target < base || target > limit)) return __EINVAL;
+
+    *offset = target;
+    return 0;
+}
+
+static hydrogen_io_res_t mem_read(FILE *stream, void *buffer, size_t size) {
+    mem_stream_t *mem = stream->__cookie;
+    if (!(mem->flags & O_RDONLY)) return (hydrogen_io_res_t){.error = __EBADF};
+
+    size_t avail = mem->position < mem->length ? mem->length - mem->position : 0;
+    if (size > avail) size = avail;
+
+    __builtin_memcpy(buffer, mem->buffer + mem->position, size);
+    mem->position += size;
+    return (hydrogen_io_res_t){.transferred = size};
+}
+
+static hydrogen_io_res_t mem_write(FILE *stream, const void *buffer, size_t size) {
+    mem_stream_t *mem = stream->__cookie;
+    if (!(mem->flags & O_WRONLY)) return (hydrogen_io_res_t){.error = __EBADF};
+    if (mem->flags & O_APPEND) mem->position = mem->length;
+
+    size_t avail = mem->size - mem->position;
+    if (size > avail) size = avail;
+    if (!size) return (hydrogen_io_res_t){.error = __ENOSPC};
+
+    __builtin_memcpy(mem->buffer + mem->position, buffer, size);
+    mem->position += size;
+
+    // Keep the contents terminated if there's space for it
+    if (mem->position > mem->length) {
+        mem->length = mem->position;
+        if (mem->length < mem->size) mem->buffer[mem->length] = 0;
+    }
+
+    return (hydrogen_io_res_t){.transferred = size};
+}
+
+static int mem_seek(FILE *stream, uint64_t *offset, hydrogen_whence_t whence) {
+    mem_stream_t *mem = stream->__cookie;
+    int error = mem_seek_to(offset, whence, mem->position, mem->length, mem->size);
+    if (error) return error;
+
+    mem->position = *offset;
+    return 0;
+}
+
+static int mem_close(FILE *stream) {
+    mem_stream_t *mem = stream->__cookie;
+    if (mem->own_buffer) free(mem->buffer);
+    free(mem);
+    return 0;
+}
+
+static const struct __stream_ops mem_ops = {
+        .read = mem_read,
+        .write = mem_write,
+        .seek = mem_seek,
+        .close = mem_close,
+};
+
+EXPORT FILE *fmemopen(void *restrict buf, size_t size, const char *restrict mode) {
+    int flags = mode_to_flags(mode);
+
+    if (!size || (!buf && !(flags & O_WRONLY))) {
+        errno = __EINVAL;
+        return NULL;
+    }
+
+    mem_stream_t *mem = malloc(sizeof(*mem));
+    if (!mem) return NULL;
+
+    mem->own_buffer = !buf;
+    mem->buffer = buf ? buf : calloc(1, size);
+    if (!mem->buffer) {
+        free(mem);
+        return NULL;
+    }
+
+    mem->size = size;
+    mem->position = 0;
+    mem->flags = flags;
+
+    switch (mode[0]) {
+    case 'r': mem->length = size; break;
+    case 'w': mem->length = 0, mem->buffer[0] = 0; break;
+    case 'a': mem->length = mem->position = strnlen((const char *)mem->buffer, size); break;
+    }
+
+    FILE *stream = alloc_stream();
+    if (!stream) {
+        if (mem->own_buffer) free(mem->buffer);
+        free(mem);
+        return NULL;
+    }
+
+    open_stream(stream, &mem_ops, mem);
+    if (flags & O_APPEND) stream->__flags |= STREAM_APPEND;
+    return stream;
+}
+
+typedef struct {
+    char *buffer;
+    size_t size;
+    size_t length;
+    size_t position;
+    char **ptr;
+    size_t *sizeloc;
+} dyn_stream_t;
+
+static hydrogen_io_res_t dyn_read(UNUSED FILE *stream, UNUSED void *buffer, UNUSED size_t size) {
+    return (hydrogen_io_res_t){.error = __EBADF};
+}
+
+static hydrogen_io_res_t dyn_write(FILE *stream, const void *buffer, size_t size) {
+    dyn_stream_t *dyn = stream->__cookie;
+    size_t end = dyn->position + size;
+
+    // The contents are always terminated, so there must be space for one byte past the end
+    if (end >= dyn->size) {
+        size_t new_size = dyn->size;
+        while (end >= new_size) new_size *= 2;
+
+        char *new_buffer = realloc(dyn->buffer, new_size);
+        if (!new_buffer) return (hydrogen_io_res_t){.error = __ENOMEM};
+
+        dyn->buffer = new_buffer;
+        dyn->size = new_size;
+        *dyn->ptr = new_buffer;
+    }
+
+    // Seeking past the end leaves a gap that reads back as zeroes
+    if (dyn->position > dyn->length) {
+        __builtin_memset(dyn->buffer + dyn->length, 0, dyn->position - dyn->length);
+    }
+
+    __builtin_memcpy(dyn->buffer + dyn->position, buffer, size);
+    dyn->position = end;
+
+    if (end > dyn->length) {
+        dyn->length = end;
+        dyn->buffer[end] = 0;
+    }
+
+    *dyn->sizeloc = end;
+    return (hydrogen_io_res_t){.transferred = size};
+}
+
+static int dyn_seek(FILE *stream, uint64_t *offset, hydrogen_whence_t whence) {
+    dyn_stream_t *dyn = stream->__cookie;
+    int error = mem_seek_to(offset, whence, dyn->position, dyn->length, SIZE_MAX - 1);
+    if (error) return error;
+
+    dyn->position = *offset;
+    *dyn->sizeloc = dyn->position < dyn->length ? dyn->position : dyn->length;
+    return 0;
+}
+
+static int dyn_close(FILE *stream) {
+    free(stream->__cookie);
+    return 0;
+}
+
+static const struct __stream_ops dyn_ops = {
+        .read = dyn_read,
+        .write = dyn_write,
+        .seek = dyn_seek,
+        .close = dyn_close,
+};
+
+EXPORT FILE *open_memstream(char **ptr, size_t *sizeloc) {
+    if (!ptr || !sizeloc) {
+        errno = __EINVAL;
+        return NULL;
+    }
+
+    dyn_stream_t *dyn = malloc(sizeof(*dyn));
+    if (!dyn) return NULL;
+
+    dyn->size = 128;
+    dyn->buffer = malloc(dyn->size);
+    if (!dyn->buffer) {
+        free(dyn);
+        return NULL;
+    }
+
+    FILE *stream = alloc_stream();
+    if (!stream) {
+        free(dyn->buffer);
+        free(dyn);
+        return NULL;
+    }
+
+    dyn->buffer[0] = 0;
+    dyn->length = 0;
+    dyn->position = 0;
+    dyn->ptr = ptr;
+    dyn->sizeloc = sizeloc;
+
+    *ptr = dyn->buffer;
+    *sizeloc = 0;
+
+    open_stream(stream, &dyn_ops, dyn);
+    return stream;
+}
+
+// User callbacks report failure by returning -1 with errno set. Our backends report it with a nonzero error code.
+static int callback_error(void) {
+    return errno ? errno : __EINVAL;
+}
+
+static int whence_to_seek(hydrogen_whence_t whence) {
+    switch (whence) {
+    case HYDROGEN_WHENCE_SET: return SEEK_SET;
+    case HYDROGEN_WHENCE_CUR: return SEEK_CUR;
+    case HYDROGEN_WHENCE_END: return SEEK_END;
+    default: __builtin_unreachable();
+    }
+}
+
+typedef struct {
+    void *cookie;
+    cookie_io_functions_t io;
+    int flags; // O_RDONLY, O_WRONLY
+} cookie_stream_t;
+
+static hydrogen_io_res_t cookie_read(FILE *stream, void *buffer, size_t size) {
+    cookie_stream_t *cs = stream->__cookie;
+    if (!(cs->flags & O_RDONLY)) return (hydrogen_io_res_t){.error = __EBADF};
+    if (!cs->io.read) return (hydrogen_io_res_t){};
+
+    ssize_t ret = cs->io.read(cs->cookie, buffer, size);
+    if (ret < 0) return (hydrogen_io_res_t){.error = callback_error()};
+    return (hydrogen_io_res_t){.transferred = ret};
+}
+
+static hydrogen_io_res_t cookie_write(FILE *stream, const void *buffer, size_t size) {
+    cookie_stream_t *cs = stream->__cookie;
+    if (!(cs->flags & O_WRONLY)) return (hydrogen_io_res_t){.error = __EBADF};
+    if (!cs->io.write) return (hydrogen_io_res_t){.transferred = size}; // output is discarded
+
+    ssize_t ret = cs->io.write(cs->cookie, buffer, size);
+    if (ret < 0) return (hydrogen_io_res_t){.error = callback_error()};
+    return (hydrogen_io_res_t){.transferred = ret};
+}
+
+static int cookie_seek(FILE *stream, uint64_t *offset, hydrogen_whence_t whence) {
+    cookie_stream_t *cs = stream->__cookie;
+    if (!cs->io.seek) return __EINVAL;
+
+    off_t off = *offset;
+    if (cs->io.seek(cs->cookie, &off, whence_to_seek(whence))) return callback_error();
+
+    *offset = off;
+    return 0;
+}
+
+static int cookie_close(FILE *stream) {
+    cookie_stream_t *cs = stream->__cookie;
+    int error = cs->io.close && cs->io.close(cs->cookie) ? callback_error() : 0;
+    free(cs);
+    return error;
+}
+
+static const struct __stream_ops cookie_ops = {
+        .read = cookie_read,
+        .write = cookie_write,
+        .seek = cookie_seek,
+        .close = cookie_close,
+};
+
+EXPORT FILE *fopencookie(void *restrict cookie, const char *restrict mode, cookie_io_functions_t io_funcs) {
+    cookie_stream_t *cs = malloc(sizeof(*cs));
+    if (!cs) return NULL;
+
+    FILE *stream = alloc_stream();
+    if (!stream) {
+        free(cs);
+        return NULL;
+    }
+
+    cs->cookie = cookie;
+    cs->io = io_funcs;
+    cs->flags = mode_to_flags(mode);
+
+    open_stream(stream, &cookie_ops, cs);
+    if (cs->flags & O_APPEND) stream->__flags |= STREAM_APPEND;
+    return stream;
+}
+
+typedef struct {
+    void *cookie;
+    int (*read)(void *, char *, int);
+    int (*write)(void *, const char *, int);
+    off_t (*seek)(void *, off_t, int);
+    int (*close)(void *);
+} funopen_stream_t;
+
+static hydrogen_io_res_t funopen_read(FILE *stream, void *buffer, size_t size) {
+    funopen_stream_t *fs = stream->__cookie;
+    if (!fs->read) return (hydrogen_io_res_t){.error = __EBADF};
+
+    int ret = fs->read(fs->cookie, buffer, size < INT_MAX ? size : INT_MAX);
+    if (ret < 0) return (hydrogen_io_res_t){.error = callback_error()};
+    return (hydrogen_io_res_t){.transferred = ret};
+}
+
+static hydrogen_io_res_t funopen_write(FILE *stream, const void *buffer, size_t size) {
+    funopen_stream_t *fs = stream->__cookie;
+    if (!fs->write) return (hydrogen_io_res_t){.error = __EBADF};
+
+    int ret = fs->write(fs->cookie, buffer, size < INT_MAX ? size : INT_MAX);
+    if (ret < 0) return (hydrogen_io_res_t){.error = callback_error()};
+    return (hydrogen_io_res_t){.transferred = ret};
+}
+
+static int funopen_seek(FILE *stream, uint64_t *offset, hydrogen_whence_t whence) {
+    funopen_stream_t *fs = stream->__cookie;
+    if (!fs->seek) return __EINVAL;
+
+    off_t ret = fs->seek(fs->cookie, *offset, whence_to_seek(whence));
+    if (ret < 0) return callback_error();
+
+    *offset = ret;
+    return 0;
+}
+
+static int funopen_close(FILE *stream) {
+    funopen_stream_t *fs = stream->__cookie;
+    int error = fs->close && fs->close(fs->cookie) ? callback_error() : 0;
+    free(fs);
+    return error;
+}
+
+static const struct __stream_ops funopen_ops = {
+        .read = funopen_read,
+        .write = funopen_write,
+        .seek = funopen_seek,
+        .close = funopen_close,
+};
+
+EXPORT FILE *funopen(
+        const void *cookie,
+        int (*readfn)(void *, char *, int),
+        int (*writefn)(void *, const char *, int),
+        off_t (*seekfn)(void *, off_t, int),
+        int (*closefn)(void *)
+) {
+    if (!readfn && !writefn) {
+        errno = __EINVAL;
+        return NULL;
+    }
+
+    funopen_stream_t *fs = malloc(sizeof(*fs));
+    if (!fs) return NULL;
+
+    FILE *stream = alloc_stream();
+    if (!stream) {
+        free(fs);
+        return NULL;
+    }
+
+    fs->cookie = (void *)cookie;
+    fs->read = readfn;
+    fs->write = writefn;
+    fs->seek = seekfn;
+    fs->close = closefn;
+
+    open_stream(stream, &funopen_ops, fs);
+    return stream;
+}
+
 EXPORT void setbuf(FILE *restrict stream, char *restrict buf) {
     UNUSED int ret = setvbuf(stream, buf, buf ? _IOFBF : _IONBF, BUFSIZ);
     assert(ret == 0);
 }
 
-EXPORT int setvbuf(UNUSED FILE *restrict stream, UNUSED char *restrict buf, UNUSED int mode, UNUSED size_t size) {
-    return 0; // TODO: Buffering
+EXPORT int setvbuf(FILE *restrict stream, char *restrict buf, int mode, size_t size) {
+    if (mode != _IOFBF && mode != _IOLBF && mode != _IONBF) {
+        errno = __EINVAL;
+        return EOF;
+    }
+
+    // This is only allowed before any I/O has happened, but don't lose data if it's called later anyway
+    make_idle(stream);
+    free_buffer(stream);
+
+    stream->__mode = mode;
+    stream->__flags &= ~STREAM_PROBE_TTY;
+
+    if (mode != _IONBF) {
+        if (buf && size > UNGET_SIZE) {
+            // Part of the buffer is used for ungetc, the rest is the actual buffer
+            stream->__buf = (unsigned char *)buf + UNGET_SIZE;
+            stream->__buf_size = size - UNGET_SIZE;
+        } else {
+            // Remember the size for when the buffer is allocated
+            stream->__buf_size = size > UNGET_SIZE ? size : 0;
+        }
+    }
+
+    return 0;
+}
+
+EXPORT int __uflow(FILE *stream) {
+    if (!to_read(stream) || !refill(stream)) return EOF;
+    return *stream->__rpos++;
+}
+
+EXPORT int __overflow(FILE *stream, int c) {
+    unsigned char v = c;
+    return fwrite(&v, sizeof(v), 1, stream) == 1 ? v : EOF;
 }
 
 EXPORT int fgetc(FILE *stream) {
-    unsigned char c;
-    return fread(&c, sizeof(c), 1, stream) == 1 ? c : EOF;
+    return getc(stream);
+}
+
+// Makes sure there's buffered input available. Returns false on EOF or error.
+static bool has_input(FILE *stream) {
+    return stream->__rpos != stream->__rend || (to_read(stream) && refill(stream));
 }
 
 EXPORT char *fgets(char *restrict s, int n, FILE *restrict stream) {
-    if (n == 0) return NULL;
+    if (n <= 0) return NULL;
 
-    char *start = s;
+    char *cur = s;
+    size_t remaining = n - 1;
 
-    for (int i = 1; i < n; i++) {
-        int value = fgetc(stream);
-        if (value == EOF) {
-            if (s == start || (stream->__flags & STREAM_EOF) == 0) return NULL;
+    while (remaining) {
+        if (!has_input(stream)) {
+            if (cur == s || (stream->__flags & STREAM_EOF) == 0) return NULL;
             break;
         }
 
-        *s++ = (unsigned char)value;
-        if (value == '\n') break;
+        size_t count = stream->__rend - stream->__rpos;
+        if (count > remaining) count = remaining;
+
+        unsigned char *newline = memchr(stream->__rpos, '\n', count);
+        if (newline) count = newline - stream->__rpos + 1;
+
+        __builtin_memcpy(cur, stream->__rpos, count);
+        stream->__rpos += count;
+        cur += count;
+        remaining -= count;
+
+        if (newline) break;
     }
 
-    *s = 0;
-    return start;
+    *cur = 0;
+    return s;
+}
+
+EXPORT ssize_t getdelim(char **restrict lineptr, size_t *restrict n, int delim, FILE *restrict stream) {
+    if (!lineptr || !n) {
+        stream->__flags |= STREAM_ERR;
+        errno = __EINVAL;
+        return -1;
+    }
+
+    if (!*lineptr) *n = 0;
+
+    size_t length = 0;
+
+    for (;;) {
+        if (!has_input(stream)) {
+            if (length == 0 || (stream->__flags & STREAM_EOF) == 0) return -1;
+            break;
+        }
+
+        size_t count = stream->__rend - stream->__rpos;
+        unsigned char *end = memchr(stream->__rpos, delim, count);
+        if (end) count = end - stream->__rpos + 1;
+
+        // Always leave space for the terminator
+        if (count >= *n - length) {
+            size_t new_size = *n ? *n : 128;
+            while (count >= new_size - length) new_size *= 2;
+
+            char *buffer = __builtin_realloc(*lineptr, new_size);
+            if (!buffer) {
+                stream->__flags |= STREAM_ERR;
+                return -1;
+            }
+
+            *lineptr = buffer;
+            *n = new_size;
+        }
+
+        __builtin_memcpy(*lineptr + length, stream->__rpos, count);
+        stream->__rpos += count;
+        length += count;
+
+        if (end) break;
+    }
+
+    (*lineptr)[length] = 0;
+    return length;
+}
+
+EXPORT ssize_t getline(char **restrict lineptr, size_t *restrict n, FILE *restrict stream) {
+    return getdelim(lineptr, n, '\n', stream);
 }
 
 EXPORT int fputc(int c, FILE *stream) {
-    unsigned char v = c;
-    return fwrite(&v, sizeof(v), 1, stream) == 1 ? v : EOF;
+    return putc(c, stream);
 }
 
 EXPORT int fputs(const char *restrict s, FILE *restrict stream) {
@@ -212,11 +1057,20 @@ EXPORT int fputs(const char *restrict s, FILE *restrict stream) {
     return fwrite(s, 1, len, stream) == len ? 0 : EOF;
 }
 
-EXPORT int getc(FILE *stream) {
-    return fgetc(stream);
+// The parentheses stop the inline macros from stdio.h from expanding in these definitions.
+EXPORT int(getc)(FILE *stream) {
+    return getc(stream);
 }
 
-EXPORT int getchar(void) {
+EXPORT int(getchar)(void) {
+    return getc(stdin);
+}
+
+EXPORT int(getc_unlocked)(FILE *stream) {
+    return getc(stream);
+}
+
+EXPORT int(getchar_unlocked)(void) {
     return getc(stdin);
 }
 
@@ -224,11 +1078,19 @@ EXPORT char *gets(char *s) {
     return fgets(s, INT_MAX, stdin);
 }
 
-EXPORT int putc(int c, FILE *stream) {
-    return fputc(c, stream);
+EXPORT int(putc)(int c, FILE *stream) {
+    return putc(c, stream);
+}
+
+EXPORT int(putchar)(int c) {
+    return putc(c, stdout);
+}
+
+EXPORT int(putc_unlocked)(int c, FILE *stream) {
+    return putc(c, stream);
 }
 
-EXPORT int putchar(int c) {
+EXPORT int(putchar_unlocked)(int c) {
     return putc(c, stdout);
 }
 
@@ -238,119 +1100,220 @@ EXPORT int puts(const char *s) {
 }
 
 EXPORT int ungetc(int c, FILE *stream) {
-    if (c == EOF || stream->__push_count == sizeof(stream->__push_buffer)) return EOF;
+    if (c == EOF || !to_read(stream)) return EOF;
 
     unsigned char v = c;
 
-    stream->__push_buffer[sizeof(stream->__push_buffer) - ++stream->__push_count] = v;
+    // Pushing back the byte that was just read doesn't have to touch the buffer, which keeps it matching the file
+    if (stream->__rpos > stream->__buf && stream->__rpos[-1] == v) {
+        stream->__rpos--;
+        stream->__flags &= ~STREAM_EOF;
+        return v;
+    }
+
+    if (stream->__flags & STREAM_MAPPED) {
+        // The mapping can't be written to, so fall back to a normal buffer
+        make_idle(stream);
+        free_buffer(stream);
+        if (!to_read(stream)) return EOF;
+    }
+
+    if (stream->__rpos == stream->__buf - UNGET_SIZE) return EOF;
+
+    *--stream->__rpos = v;
+    stream->__flags |= STREAM_UNGETC;
     stream->__flags &= ~STREAM_EOF;
 
     return v;
 }
 
-static hydrogen_io_res_t do_read(FILE *stream, void *buffer, size_t count) {
-    size_t extra = stream->__push_count;
+EXPORT size_t fread(void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
+    size_t count = size * nmemb;
+    if (!count) return 0;
+    if (!to_read(stream)) return 0;
+
+    unsigned char *dest = ptr;
+    size_t remaining = count;
+
+    for (;;) {
+        size_t avail = stream->__rend - stream->__rpos;
+        if (avail > remaining) avail = remaining;
+
+        __builtin_memcpy(dest, stream->__rpos, avail);
+        stream->__rpos += avail;
+        dest += avail;
+        remaining -= avail;
+
+        if (!remaining) break;
+
+        // Read straight into the destination if the data wouldn't fit in the buffer anyway. Mapped streams don't
+        // need this, their buffer already holds everything.
+        bool direct = stream->__mode == _IONBF || remaining >= stream->__buf_size;
+
+        if (direct && !(stream->__flags & STREAM_MAPPED)) {
+            if (stream->__flags & STREAM_EOF) break;
+            if (stream->__mode != _IOFBF) flush_line_buffered();
+
+            hydrogen_io_res_t res = stream->__ops->read(stream, dest, remaining);
+            if (res.error) {
+                errno = res.error;
+                stream->__flags |= STREAM_ERR;
+                break;
+            }
+            if (!res.transferred) {
+                stream->__flags |= STREAM_EOF;
+                break;
+            }
+
+            advance(stream, res.transferred);
+            dest += res.transferred;
+            remaining -= res.transferred;
+            if (!remaining) break;
+            continue;
+        }
+
+        if (!refill(stream)) break;
+    }
+
+    return (count - remaining) / size;
+}
+
+EXPORT size_t fwrite(const void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
+    size_t count = size * nmemb;
+    if (!count) return 0;
+
+    to_write(stream);
 
-    if (extra) {
-        if (extra > count) extra = count;
+    const unsigned char *src = ptr;
+    size_t remaining = count;
+    size_t space = stream->__wend - stream->__wpos;
 
-        __builtin_memcpy(buffer, &stream->__push_buffer[sizeof(stream->__push_buffer) - stream->__push_count], extra);
+    if (remaining > space) {
+        if (stream->__wpos != stream->__buf) {
+            // There's no gathered write, so fill up the buffer with the start of the data and write it out as one
+            // full block instead of writing the pending data and the new data separately
+            __builtin_memcpy(stream->__wpos, src, space);
+            stream->__wpos += space;
+            src += space;
+            remaining -= space;
 
-        buffer += extra;
-        count -= extra;
+            if (!flush_write(stream)) return 0;
+        }
 
-        if (count == 0) {
-            stream->__push_count -= extra;
-            return (hydrogen_io_res_t){extra, 0};
+        // Don't copy data that wouldn't fit in the buffer anyway
+        if (remaining >= (size_t)(stream->__wend - stream->__wpos)) {
+            return (count - remaining + write_all(stream, src, remaining)) / size;
         }
     }
 
-    hydrogen_io_res_t res = hydrogen_read(stream->__fd, buffer, count);
-    if (res.error) return res;
+    __builtin_memcpy(stream->__wpos, src, remaining);
+    stream->__wpos += remaining;
 
-    stream->__push_count -= extra;
-    if (!res.transferred) stream->__flags |= STREAM_EOF;
+    if (stream->__mode == _IOLBF && memrchr(src, '\n', remaining) && !flush_write(stream)) return 0;
 
-    res.transferred += extra;
-    return res;
+    return nmemb;
 }
 
-EXPORT size_t fread(void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
-    size_t count = size * nmemb;
-    if (!count) return 0;
-    if (stream->__flags & STREAM_EOF) return 0;
+EXPORT size_t __freadahead(FILE *stream) {
+    return stream->__rend - stream->__rpos;
+}
 
-    hydrogen_io_res_t res = do_read(stream, ptr, count);
-    if (res.error) {
-        errno = res.error;
-        stream->__flags |= STREAM_ERR;
-        return 0;
-    }
+EXPORT const char *__freadptr(FILE *stream, size_t *size) {
+    if (!has_input(stream)) return NULL;
 
-    return res.transferred / size;
+    *size = stream->__rend - stream->__rpos;
+    return (const char *)stream->__rpos;
 }
 
-EXPORT size_t fwrite(const void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
-    size_t count = size * nmemb;
-    if (!count) return 0;
+EXPORT void __freadptrinc(FILE *stream, size_t size) {
+    stream->__rpos += size;
+}
 
-    hydrogen_io_res_t res = hydrogen_write(stream->__fd, ptr, count);
-    if (res.error) {
-        errno = res.error;
-        stream->__flags |= STREAM_ERR;
-        return 0;
-    }
+EXPORT size_t fread_unlocked(void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
+    return fread(ptr, size, nmemb, stream);
+}
+
+EXPORT size_t fwrite_unlocked(const void *restrict ptr, size_t size, size_t nmemb, FILE *restrict stream) {
+    return fwrite(ptr, size, nmemb, stream);
+}
 
-    return res.transferred / size;
+static uint64_t pending_write(FILE *stream) {
+    return stream->__wpos ? stream->__wpos - stream->__buf : 0;
 }
 
 EXPORT int fgetpos(FILE *restrict stream, fpos_t *restrict pos) {
-    int error = hydrogen_seek(stream->__fd, &pos->__offset, HYDROGEN_WHENCE_CUR);
+    // Buffered output of an append stream will be written at the end, wherever the backend is now
+    bool at_end = (stream->__flags & STREAM_APPEND) && pending_write(stream);
 
-    if (error == 0) {
-        pos->__offset -= stream->__push_count;
-        return 0;
-    } else {
-        errno = error;
-        return 1;
+    if (stream->__offset < 0 || at_end) {
+        int error = seek_backend(stream, 0, at_end ? HYDROGEN_WHENCE_END : HYDROGEN_WHENCE_CUR);
+        if (error) {
+            errno = error;
+            return 1;
+        }
     }
+
+    pos->__offset = stream->__offset - (stream->__rend - stream->__rpos) + pending_write(stream);
+    return 0;
 }
 
-EXPORT int fseek(FILE *stream, long offset, int whence) {
-    uint64_t off = offset;
-    hydrogen_whence_t hwhence;
+// Tries to satisfy a seek by moving the read pointer within the buffered input. This isn't possible if ungetc
+// replaced some of the buffered bytes.
+static bool seek_in_buffer(FILE *stream, int64_t offset, hydrogen_whence_t whence) {
+    if (!stream->__rpos || stream->__offset < 0 || (stream->__flags & STREAM_UNGETC)) return false;
+
+    int64_t end = stream->__offset;
+    int64_t start = end - (stream->__rend - stream->__buf);
+    int64_t target;
 
     switch (whence) {
-    case SEEK_SET: hwhence = HYDROGEN_WHENCE_SET; break;
-    case SEEK_CUR: hwhence = HYDROGEN_WHENCE_CUR; break;
-    case SEEK_END: hwhence = HYDROGEN_WHENCE_END; break;
-    default: __builtin_unreachable();
+    case HYDROGEN_WHENCE_SET: target = offset; break;
+    case HYDROGEN_WHENCE_CUR: target = end - (stream->__rend - stream->__rpos) + offset; break;
+    default: return false;
     }
 
-    int error = hydrogen_seek(stream->__fd, &off, hwhence);
+    if (target < start || target > end) return false;
+
+    stream->__rpos = stream->__buf + (target - start);
+    stream->__flags &= ~STREAM_EOF;
+    return true;
+}
+
+static int do_seek(FILE *stream, int64_t offset, hydrogen_whence_t whence) {
+    if (seek_in_buffer(stream, offset, whence)) return 0;
+
+    // Relative seeks are relative to the logical position, not the descriptor's
+    if (whence == HYDROGEN_WHENCE_CUR) offset -= stream->__rend - stream->__rpos;
+    stream->__rpos = stream->__rend = NULL;
+    stream->__flags &= ~STREAM_UNGETC;
+
+    if (!make_idle(stream)) return 1;
+
+    int error = seek_backend(stream, offset, whence);
     if (error) {
         errno = error;
         return 1;
     }
 
-    stream->__push_count = 0;
     stream->__flags &= ~STREAM_EOF;
-
     return 0;
 }
 
-EXPORT int fsetpos(FILE *stream, const fpos_t *pos) {
-    uint64_t off = pos->__offset;
-    int error = hydrogen_seek(stream->__fd, &off, HYDROGEN_WHENCE_SET);
-    if (error) {
-        errno = error;
-        return 1;
+EXPORT int fseek(FILE *stream, long offset, int whence) {
+    hydrogen_whence_t hwhence;
+
+    switch (whence) {
+    case SEEK_SET: hwhence = HYDROGEN_WHENCE_SET; break;
+    case SEEK_CUR: hwhence = HYDROGEN_WHENCE_CUR; break;
+    case SEEK_END: hwhence = HYDROGEN_WHENCE_END; break;
+    default: __builtin_unreachable();
     }
 
-    stream->__push_count = 0;
-    stream->__flags &= ~STREAM_EOF;
+    return do_seek(stream, offset, hwhence);
+}
 
-    return 0;
+EXPORT int fsetpos(FILE *stream, const fpos_t *pos) {
+    return do_seek(stream, pos->__offset, HYDROGEN_WHENCE_SET);
 }
 
 EXPORT long ftell(FILE *stream) {
@@ -360,10 +1323,7 @@ EXPORT long ftell(FILE *stream) {
 }
 
 EXPORT void rewind(FILE *stream) {
-    uint64_t off = 0;
-    hydrogen_seek(stream->__fd, &off, HYDROGEN_WHENCE_SET); // discard error
-
-    stream->__push_count = 0;
+    do_seek(stream, 0, HYDROGEN_WHENCE_SET); // discard error
     stream->__flags &= ~(STREAM_EOF | STREAM_ERR);
 }
 
@@ -3,4 +3,6 @@
 
 void init_stdio(void);
 
+void exit_stdio(void);
+
 #endif // LIBC_STDIO_P_H
@@ -1,11 +1,13 @@
 #include "stdlib.h"
 #include "compiler.h"
 #include "ctype.h"
+#include "digits.p.h"
 #include "errno.h"
 #include "hydrogen/sched.h"
+#include "inttypes.h"
 #include "limits.h"
-#include "math.h"
 #include "signal.h"
+#include "stdio.p.h"
 #include "stdlib.p.h"
 #include <stdbool.h>
 #include <stddef.h>
@@ -25,125 +27,8 @@ EXPORT long atol(const char *nptr) {
     return strtol(nptr, NULL, 10);
 }
 
-typedef struct {
-    const char *data;
-    size_t length;
-} tagged_str_t;
-
-typedef struct {
-    bool negative;
-    tagged_str_t whole;
-    tagged_str_t frac;
-    int exponent;
-} fp_parts_t;
-
-static int parse_exponent(const char **str) {
-    const char *cur = *str;
-    if ((cur[0] & ~0x20) != 'E') return 0;
-
-    bool negative = cur[1] == '-';
-    if (negative || cur[1] == '+') cur++;
-
-    char c = cur[1];
-    if (c < '0' || c > '9') return 0;
-    int value = c - '0';
-
-    for (;;) {
-        char c = cur[2];
-        if (c < '0' || c > '9') break;
-        value = value * 10 + (c - '0');
-        cur++;
-    }
-
-    *str = &cur[2];
-    return value;
-}
-
-static bool get_fp_parts(const char *str, char **endptr, fp_parts_t *out) {
-    while (isspace(*str)) str++;
-
-    out->negative = str[0] == '-';
-    if (out->negative || str[0] == '+') str++;
-
-    tagged_str_t *cur = &out->whole;
-    cur->data = str;
-    size_t num_digits = 0;
-
-    for (;;) {
-        char c = *str;
-
-        if (c == '.') {
-            if (cur == &out->frac) break;
-
-            cur = &out->frac;
-            str++;
-            cur->data = str;
-            continue;
-        }
-
-        if (c < '0' || c > '9') break;
-
-        str++;
-        cur->length++;
-        num_digits++;
-    }
-
-    if (num_digits == 0) return false;
-
-    out->exponent = parse_exponent(&str);
-    if (endptr) *endptr = (char *)str;
-    return true;
-}
-
-// https://en.wikipedia.org/wiki/Exponentiation_by_squaring
-static double ipow(double x, int n) {
-    if (n < 0) {
-        x = 1 / x;
-        n = -n;
-    } else if (n == 0) {
-        return 1;
-    }
-
-    double y = 1;
-    while (n > 1) {
-        if (n & 1) {
-            y *= y;
-            n -= 1;
-        }
-
-        x *= x;
-        n >>= 1;
-    }
-
-    return x * y;
-}
-
-// TODO: Use a proper decimal-to-binary algorithm, since this isn't particularly accurate
-EXPORT double strtod(const char *restrict nptr, char **restrict endptr) {
-    fp_parts_t parts = {};
-    if (!get_fp_parts(nptr, endptr, &parts)) {
-        if (endptr) *endptr = (char *)nptr;
-        return 0.0;
-    }
-
-    double value = 0.0;
-
-    for (size_t i = 0; i < parts.whole.length; i++) {
-        value = (value * 10) + (*parts.whole.data++ - '0');
-    }
-
-    for (size_t i = 0; i < parts.frac.length; i++) {
-        value = (value * 10) + (*parts.frac.data++ - '0');
-    }
-
-    value *= ipow(10, parts.exponent - parts.frac.length);
-
-    if (__builtin_isinf(value)) {
-        errno = ERANGE;
-        return HUGE_VAL;
-    }
-
-    return !parts.negative ? value : -value;
+EXPORT long long atoll(const char *nptr) {
+    return strtoll(nptr, NULL, 10);
 }
 
 static int dval(char digit, int base) {
@@ -166,10 +51,35 @@ typedef struct {
     bool overflow;
 } int_parts_t;
 
+#define MAX_SAFE_DIGITS 19
+
+static const char *parse_dec_int(const char *str, int_parts_t *out) {
+    // leading zeroes don't count towards the digits that are guaranteed to fit
+    while (*str == '0') str++;
+
+    const char *start = str;
+    str = parse_dec(str, MAX_SAFE_DIGITS, &out->abs);
+
+    if (str - start == MAX_SAFE_DIGITS && (unsigned char)(*str - '0') < 10) {
+        if (__builtin_umull_overflow(out->abs, 10, &out->abs) ||
+            __builtin_uaddl_overflow(out->abs, *str - '0', &out->abs)) {
+            out->overflow = true;
+        }
+
+        for (str++; (unsigned char)(*str - '0') < 10; str++) {
+            out->overflow = true;
+        }
+    }
+
+    return str;
+}
+
 static bool get_int_parts(const char *nptr, char **endptr, int base, int_parts_t *out) {
     const char *str = nptr;
     while (isspace(*str)) str++;
 
+    out->abs = 0;
+    out->overflow = false;
     out->negative = str[0] == '-';
     if (out->negative || str[0] == '+') str++;
 
@@ -181,7 +91,6 @@ static bool get_int_parts(const char *nptr, char **endptr, int base, int_parts_t
                 str += 2;
             } else {
                 base = 8;
-                str++;
             }
         } else {
             base = 10;
@@ -195,19 +104,23 @@ static bool get_int_parts(const char *nptr, char **endptr, int base, int_parts_t
 
     const char *start = str;
 
-    for (;;) {
-        char c = *str;
-        int val = dval(c, base);
-        if (val < 0) break;
-
-        if (!out->overflow) {
-            if (__builtin_umull_overflow(out->abs, base, &out->abs) ||
-                __builtin_uaddl_overflow(out->abs, val, &out->abs)) {
-                out->overflow = true;
+    if (base == 10) {
+        str = parse_dec_int(str, out);
+    } else {
+        for (;;) {
+            char c = *str;
+            int val = dval(c, base);
+            if (val < 0) break;
+
+            if (!out->overflow) {
+                if (__builtin_umull_overflow(out->abs, base, &out->abs) ||
+                    __builtin_uaddl_overflow(out->abs, val, &out->abs)) {
+                    out->overflow = true;
+                }
             }
-        }
 
-        str++;
+            str++;
+        }
     }
 
     if (str != start) {
@@ -251,6 +164,24 @@ EXPORT unsigned long strtoul(const char *restrict nptr, char **restrict endptr,
     }
 }
 
+// long long and intmax_t have the same representation as long, so these just forward to the long versions.
+
+EXPORT long long strtoll(const char *restrict nptr, char **restrict endptr, int base) {
+    return strtol(nptr, endptr, base);
+}
+
+EXPORT unsigned long long strtoull(const char *restrict nptr, char **restrict endptr, int base) {
+    return strtoul(nptr, endptr, base);
+}
+
+EXPORT intmax_t strtoimax(const char *restrict nptr, char **restrict endptr, int base) {
+    return strtol(nptr, endptr, base);
+}
+
+EXPORT uintmax_t strtoumax(const char *restrict nptr, char **restrict endptr, int base) {
+    return strtoul(nptr, endptr, base);
+}
+
 #define RAND_LCG_MULT 25214903917
 #define RAND_LCG_INCR 11
 #define RAND_LCG_BITS 48
@@ -296,7 +227,7 @@ EXPORT __attribute__((__noreturn__)) void exit(UNUSED int status) {
         atexit_funcs = atexit_funcs->next;
     }
 
-    // TODO: Flush & close all streams
+    exit_stdio();
 
     hydrogen_exit();
 }
@@ -417,6 +348,14 @@ EXPORT ldiv_t ldiv(long numer, long denom) {
     return (ldiv_t){numer / denom, numer % denom};
 }
 
+EXPORT intmax_t imaxabs(intmax_t j) {
+    return j >= 0 ? j : -j;
+}
+
+EXPORT imaxdiv_t imaxdiv(intmax_t numer, intmax_t denom) {
+    return (imaxdiv_t){numer / denom, numer % denom};
+}
+
 EXPORT int mblen(const char *s, size_t n) {
     return mbtowc(NULL, s, n); // this is ok because mbtowc is stateless
 }
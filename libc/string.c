@@ -1,8 +1,88 @@
 #include "string.h"
 #include "compiler.h"
 #include "errno.h"
+#include "stdlib.h"
+#include "string.p.h"
+#include <cpuid.h>
+#include <emmintrin.h>
 #include <stdint.h>
 
+typedef uint16_t __attribute__((aligned(1), may_alias)) u16_unaligned_t;
+typedef uint32_t __attribute__((aligned(1), may_alias)) u32_unaligned_t;
+typedef uint64_t __attribute__((aligned(1), may_alias)) u64_unaligned_t;
+
+#define VEC_SIZE sizeof(__m128i)
+
+// The scanning functions below only ever load whole aligned vectors. Those can't cross a page boundary, so reading
+// past the end of the string (or before its start) within such a vector is always safe.
+#define ALIGN_DOWN(ptr) ((const unsigned char *)((uintptr_t)(ptr) & ~(VEC_SIZE - 1)))
+
+// Returns a mask with bit i set if byte i of the aligned vector at ptr is equal to byte i of needle.
+static inline unsigned match_mask(const unsigned char *ptr, __m128i needle) {
+    return _mm_movemask_epi8(_mm_cmpeq_epi8(_mm_load_si128((const __m128i *)ptr), needle));
+}
+
+// Copies and fills of at least this many bytes use non-temporal stores, so that they don't evict the rest of the
+// working set from the cache. Stays at SIZE_MAX (never) until init_string has looked at the cache hierarchy.
+static size_t nt_threshold = SIZE_MAX;
+
+// Returns the size of the largest data or unified cache reported by the deterministic cache parameter leaves
+// (0x4 on Intel, 0x8000001d on AMD), or 0 if it can't be determined.
+static size_t get_cache_size_from_leaf(unsigned leaf) {
+    size_t max_size = 0;
+
+    for (unsigned i = 0;; i++) {
+        unsigned eax, ebx, ecx, edx;
+        __cpuid_count(leaf, i, eax, ebx, ecx, edx);
+
+        unsigned type = eax & 0x1f;
+        if (type == 0) break;
+        if (type == 2) continue; // instruction cache
+
+        size_t ways = ((ebx >> 22) & 0x3ff) + 1;
+        size_t partitions = ((ebx >> 12) & 0x3ff) + 1;
+        size_t line_size = (ebx & 0xfff) + 1;
+        size_t sets = (size_t)ecx + 1;
+        size_t size = ways * partitions * line_size * sets;
+
+        if (size > max_size) max_size = size;
+    }
+
+    return max_size;
+}
+
+static size_t get_llc_size(void) {
+    unsigned eax, ebx, ecx, edx;
+    unsigned max_leaf = __get_cpuid_max(0, NULL);
+    unsigned max_ext_leaf = __get_cpuid_max(0x80000000, NULL);
+    size_t size = 0;
+
+    if (max_leaf >= 4) size = get_cache_size_from_leaf(4);
+    if (size == 0 && max_ext_leaf >= 0x8000001d) size = get_cache_size_from_leaf(0x8000001d);
+
+    if (size == 0 && max_ext_leaf >= 0x80000006) {
+        __cpuid(0x80000006, eax, ebx, ecx, edx);
+        size = (size_t)(ecx >> 16) * 1024; // L2 size in KiB
+    }
+
+    return size;
+}
+
+void init_string(void) {
+    // Both the source and the destination of a copy compete for the cache, so switch over a bit before the buffer
+    // itself is as large as the last-level cache.
+    size_t threshold = get_llc_size() / 4 * 3;
+
+    const char *env = getenv("LIBC_NT_THRESHOLD");
+    if (env) {
+        char *end;
+        size_t value = strtoul(env, &end, 0);
+        if (end != env && *end == 0) threshold = value;
+    }
+
+    nt_threshold = threshold ? threshold : SIZE_MAX;
+}
+
 EXPORT int memcmp(const void *s1, const void *s2, size_t n) {
     const unsigned char *b1 = s1;
     const unsigned char *b2 = s2;
@@ -18,17 +98,75 @@ EXPORT int memcmp(const void *s1, const void *s2, size_t n) {
     return 0;
 }
 
+// Copies n < VEC_SIZE bytes using two possibly overlapping loads and stores.
+static void copy_small(unsigned char *restrict d, const unsigned char *restrict s, size_t n) {
+    if (n >= 8) {
+        uint64_t head = *(const u64_unaligned_t *)s;
+        uint64_t tail = *(const u64_unaligned_t *)(s + n - 8);
+        *(u64_unaligned_t *)d = head;
+        *(u64_unaligned_t *)(d + n - 8) = tail;
+    } else if (n >= 4) {
+        uint32_t head = *(const u32_unaligned_t *)s;
+        uint32_t tail = *(const u32_unaligned_t *)(s + n - 4);
+        *(u32_unaligned_t *)d = head;
+        *(u32_unaligned_t *)(d + n - 4) = tail;
+    } else if (n >= 2) {
+        uint16_t head = *(const u16_unaligned_t *)s;
+        uint16_t tail = *(const u16_unaligned_t *)(s + n - 2);
+        *(u16_unaligned_t *)d = head;
+        *(u16_unaligned_t *)(d + n - 2) = tail;
+    } else if (n) {
+        *d = *s;
+    }
+}
+
 EXPORT void *memcpy(void *restrict dest, const void *restrict src, size_t n) {
     unsigned char *d = dest;
     const unsigned char *s = src;
 
-    while (n--) {
-        *d++ = *s++;
+    if (n < VEC_SIZE) {
+        copy_small(d, s, n);
+        return dest;
     }
 
+    // The first and last vectors are copied unaligned, which lets the loop below only do aligned stores and not
+    // worry about the tail.
+    __m128i head = _mm_loadu_si128((const __m128i *)s);
+    __m128i tail = _mm_loadu_si128((const __m128i *)(s + n - VEC_SIZE));
+    unsigned char *tail_dest = d + n - VEC_SIZE;
+
+    size_t skip = VEC_SIZE - ((uintptr_t)d & (VEC_SIZE - 1));
+    _mm_storeu_si128((__m128i *)d, head);
+    d += skip;
+    s += skip;
+    n -= skip;
+
+    size_t count = n / VEC_SIZE;
+
+    if (n >= nt_threshold) {
+        while (count--) {
+            _mm_stream_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+            d += VEC_SIZE;
+            s += VEC_SIZE;
+        }
+
+        _mm_sfence();
+    } else {
+        while (count--) {
+            _mm_store_si128((__m128i *)d, _mm_loadu_si128((const __m128i *)s));
+            d += VEC_SIZE;
+            s += VEC_SIZE;
+        }
+    }
+
+    _mm_storeu_si128((__m128i *)tail_dest, tail);
     return dest;
 }
 
+EXPORT void *mempcpy(void *restrict dest, const void *restrict src, size_t n) {
+    return __builtin_memcpy(dest, src, n) + n;
+}
+
 EXPORT void *memmove(void *dest, const void *src, size_t n) {
     unsigned char *d = dest;
     const unsigned char *s = src;
@@ -53,8 +191,42 @@ EXPORT void *memset(void *dest, int value, size_t n) {
     unsigned char *d = dest;
     unsigned char c = value;
 
-    while (n--) {
-        *d++ = c;
+    if (n < VEC_SIZE) {
+        uint64_t pattern = c * 0x0101010101010101ul;
+
+        if (n >= 8) {
+            *(u64_unaligned_t *)d = pattern;
+            *(u64_unaligned_t *)(d + n - 8) = pattern;
+        } else if (n >= 4) {
+            *(u32_unaligned_t *)d = pattern;
+            *(u32_unaligned_t *)(d + n - 4) = pattern;
+        } else if (n >= 2) {
+            *(u16_unaligned_t *)d = pattern;
+            *(u16_unaligned_t *)(d + n - 2) = pattern;
+        } else if (n) {
+            *d = c;
+        }
+
+        return dest;
+    }
+
+    __m128i vec = _mm_set1_epi8(c);
+    _mm_storeu_si128((__m128i *)d, vec);
+    _mm_storeu_si128((__m128i *)(d + n - VEC_SIZE), vec);
+
+    unsigned char *end = (unsigned char *)((uintptr_t)(d + n) & ~(VEC_SIZE - 1));
+    d = (unsigned char *)(((uintptr_t)d + VEC_SIZE) & ~(VEC_SIZE - 1));
+
+    if (n >= nt_threshold) {
+        for (; d < end; d += VEC_SIZE) {
+            _mm_stream_si128((__m128i *)d, vec);
+        }
+
+        _mm_sfence();
+    } else {
+        for (; d < end; d += VEC_SIZE) {
+            _mm_store_si128((__m128i *)d, vec);
+        }
     }
 
     return dest;
@@ -71,45 +243,117 @@ EXPORT int strcmp(const char *s1, const char *s2) {
     }
 }
 
-EXPORT char *strcpy(char *restrict s1, const char *restrict s2) {
-    char *d = s1;
+// Copies the string at s to d, stopping at the terminator or after n bytes, whichever comes first. The terminator
+// itself is not copied. Returns the number of bytes copied. The string is scanned and copied in the same pass, so
+// every source byte is only loaded once (apart from the overlapping head and tail vectors).
+static size_t copy_string(unsigned char *restrict d, const unsigned char *restrict s, size_t n) {
+    // With no bytes to copy, s may be the end of an array that lies directly before an unmapped page
+    if (n == 0) return 0;
+
+    const unsigned char *cur = ALIGN_DOWN(s);
+    __m128i zero = _mm_setzero_si128();
+    unsigned mask = match_mask(cur, zero) >> (s - cur);
+    size_t len;
+
+    if (mask) {
+        len = __builtin_ctz(mask);
+        if (len > n) len = n;
+        copy_small(d, s, len);
+        return len;
+    }
 
-    for (;;) {
-        char c = *s2++;
-        *d++ = c;
-        if (c == 0) break;
+    cur += VEC_SIZE;
+
+    if ((size_t)(cur - s) >= n) {
+        len = n;
+    } else {
+        // Every aligned vector that is entirely part of the string gets stored as soon as it has been checked.
+        for (;;) {
+            mask = match_mask(cur, zero);
+
+            if (mask) {
+                len = cur - s + __builtin_ctz(mask);
+                if (len > n) len = n;
+                break;
+            }
+
+            if ((size_t)(cur + VEC_SIZE - s) >= n) {
+                len = n;
+                break;
+            }
+
+            _mm_storeu_si128((__m128i *)(d + (cur - s)), _mm_load_si128((const __m128i *)cur));
+            cur += VEC_SIZE;
+        }
     }
 
+    // Store the unaligned head and tail, which overlap with the vectors stored in the loop.
+    if (len >= VEC_SIZE) {
+        __m128i head = _mm_loadu_si128((const __m128i *)s);
+        __m128i tail = _mm_loadu_si128((const __m128i *)(s + len - VEC_SIZE));
+        _mm_storeu_si128((__m128i *)d, head);
+        _mm_storeu_si128((__m128i *)(d + len - VEC_SIZE), tail);
+    } else {
+        copy_small(d, s, len);
+    }
+
+    return len;
+}
+
+EXPORT char *strcpy(char *restrict s1, const char *restrict s2) {
+    size_t len = copy_string((unsigned char *)s1, (const unsigned char *)s2, SIZE_MAX);
+    s1[len] = 0;
     return s1;
 }
 
 EXPORT char *strncpy(char *restrict s1, const char *restrict s2, size_t n) {
-    char *d = s1;
+    size_t len = copy_string((unsigned char *)s1, (const unsigned char *)s2, n);
+    __builtin_memset(s1 + len, 0, n - len);
+    return s1;
+}
 
-    while (n) {
-        char c = *s2++;
-        if (c == 0) break;
-        *d++ = c;
-        n--;
-    }
+EXPORT char *stpcpy(char *restrict s1, const char *restrict s2) {
+    size_t len = copy_string((unsigned char *)s1, (const unsigned char *)s2, SIZE_MAX);
+    s1[len] = 0;
+    return s1 + len;
+}
 
-    while (n--) {
-        *d++ = 0;
-    }
+EXPORT char *stpncpy(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = copy_string((unsigned char *)s1, (const unsigned char *)s2, n);
+    __builtin_memset(s1 + len, 0, n - len);
+    return s1 + len;
+}
 
-    return s1;
+EXPORT size_t strlcpy(char *restrict s1, const char *restrict s2, size_t n) {
+    if (n == 0) return __builtin_strlen(s2);
+
+    size_t len = copy_string((unsigned char *)s1, (const unsigned char *)s2, n - 1);
+    s1[len] = 0;
+
+    // Only if the string was truncated does the rest of it still need to be measured
+    return len == n - 1 ? len + __builtin_strlen(s2 + len) : len;
 }
 
 EXPORT char *strcat(char *restrict s1, const char *restrict s2) {
-    __builtin_strcpy(s1 + __builtin_strlen(s1), s2);
+    char *d = s1 + __builtin_strlen(s1);
+    size_t len = copy_string((unsigned char *)d, (const unsigned char *)s2, SIZE_MAX);
+    d[len] = 0;
     return s1;
 }
 
 EXPORT char *strncat(char *restrict s1, const char *restrict s2, size_t n) {
-    __builtin_strncpy(s1 + __builtin_strlen(s1), s2, n + 1);
+    char *d = s1 + __builtin_strlen(s1);
+    size_t len = copy_string((unsigned char *)d, (const unsigned char *)s2, n);
+    d[len] = 0;
     return s1;
 }
 
+EXPORT size_t strlcat(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = strnlen(s1, n);
+    if (len == n) return n + __builtin_strlen(s2);
+    return len + strlcpy(s1 + len, s2, n - len);
+}
+
 EXPORT int strcoll(const char *s1, const char *s2) {
     return __builtin_strcmp(s1, s2); // TODO: Locale support
 }
@@ -146,38 +390,79 @@ EXPORT size_t strxfrm(char *restrict s1, const char *restrict s2, size_t n) {
 }
 
 EXPORT void *memchr(const void *s, int c, size_t n) {
-    const unsigned char *str = s;
-    unsigned char val = c;
+    if (n == 0) return NULL;
 
-    while (n--) {
-        unsigned char cur = *str;
-        if (cur == val) return (void *)str;
-        str++;
+    const unsigned char *start = s;
+    const unsigned char *cur = ALIGN_DOWN(start);
+    __m128i needle = _mm_set1_epi8(c);
+    unsigned mask = match_mask(cur, needle) & (~0u << (start - cur));
+
+    for (;;) {
+        if (mask) {
+            const unsigned char *found = cur + __builtin_ctz(mask);
+            return (size_t)(found - start) < n ? (void *)found : NULL;
+        }
+
+        cur += VEC_SIZE;
+        if ((size_t)(cur - start) >= n) return NULL;
+        mask = match_mask(cur, needle);
     }
+}
+
+EXPORT void *memrchr(const void *s, int c, size_t n) {
+    if (n == 0) return NULL;
+
+    const unsigned char *start = s;
+    const unsigned char *end = start + n;
+    const unsigned char *cur = ALIGN_DOWN(end - 1);
+    __m128i needle = _mm_set1_epi8(c);
+    unsigned mask = match_mask(cur, needle) & (0xffff >> (VEC_SIZE - (end - cur)));
+
+    for (;;) {
+        if (cur <= start) {
+            mask &= ~0u << (start - cur);
+            return mask ? (void *)(cur + (31 - __builtin_clz(mask))) : NULL;
+        }
+
+        if (mask) return (void *)(cur + (31 - __builtin_clz(mask)));
 
+        cur -= VEC_SIZE;
+        mask = match_mask(cur, needle);
+    }
+}
+
+EXPORT void *memccpy(void *restrict s1, const void *restrict s2, int c, size_t n) {
+    const unsigned char *found = __builtin_memchr(s2, c, n);
+
+    if (found) {
+        size_t len = found - (const unsigned char *)s2 + 1;
+        return __builtin_memcpy(s1, s2, len) + len;
+    }
+
+    __builtin_memcpy(s1, s2, n);
     return NULL;
 }
 
 EXPORT char *strchr(const char *s, int c) {
     char val = c;
 
-    for (char cur = *s; cur != 0; cur = *++s) {
+    // The terminator is part of the string, so searching for it finds it
+    for (;;) {
+        char cur = *s;
         if (cur == val) return (char *)s;
+        if (cur == 0) return NULL;
+        s++;
     }
-
-    return NULL;
 }
 
 EXPORT size_t strcspn(const char *s1, const char *s2) {
-    size_t len = 0;
+    const char *start = s1;
 
-    for (;;) {
-        char c1 = *s1++;
-        char c2 = *s2++;
-        if (c1 == c2) return len;
-        if (!(c1 | c2)) return len;
-        len++;
+    for (char c = *s1; c != 0; c = *++s1) {
+        if (__builtin_strchr(s2, c)) break;
     }
+
+    return s1 - start;
 }
 
 EXPORT char *strpbrk(const char *s1, const char *s2) {
@@ -192,23 +477,22 @@ EXPORT char *strrchr(const char *s1, int c) {
     char *last = NULL;
     char val = c;
 
-    for (char cur = *s1; cur != 0; cur = *s1++) {
+    for (;;) {
+        char cur = *s1;
         if (cur == val) last = (char *)s1;
+        if (cur == 0) return last;
+        s1++;
     }
-
-    return last;
 }
 
 EXPORT size_t strspn(const char *s1, const char *s2) {
-    size_t len = 0;
+    const char *start = s1;
 
-    for (;;) {
-        char c1 = *s1++;
-        char c2 = *s2++;
-        if (c1 != c2) return len;
-        if (!c1) return len;
-        len++;
+    for (char c = *s1; c != 0; c = *++s1) {
+        if (!__builtin_strchr(s2, c)) break;
     }
+
+    return s1 - start;
 }
 
 EXPORT char *strstr(const char *s1, const char *s2) {
@@ -257,8 +541,6 @@ EXPORT char *strtok(char *restrict s1, const char *restrict s2) {
             *end = 0;
             return cur;
         }
-
-        end++;
     }
 
     state = end;
@@ -294,7 +576,40 @@ EXPORT char *strerror(int errnum) {
 }
 
 EXPORT size_t strlen(const char *s) {
-    size_t len = 0;
-    while (s[len]) len++;
-    return len;
+    const unsigned char *start = (const unsigned char *)s;
+    const unsigned char *cur = ALIGN_DOWN(start);
+    __m128i zero = _mm_setzero_si128();
+    unsigned mask = match_mask(cur, zero) >> (start - cur);
+
+    if (mask) return __builtin_ctz(mask);
+
+    for (;;) {
+        cur += VEC_SIZE;
+        mask = match_mask(cur, zero);
+        if (mask) return cur - start + __builtin_ctz(mask);
+    }
+}
+
+EXPORT size_t strnlen(const char *s, size_t n) {
+    const char *end = __builtin_memchr(s, 0, n);
+    return end ? (size_t)(end - s) : n;
+}
+
+EXPORT char *strdup(const char *s) {
+    size_t size = __builtin_strlen(s) + 1;
+    char *copy = __builtin_malloc(size);
+    if (copy) __builtin_memcpy(copy, s, size);
+    return copy;
+}
+
+EXPORT char *strndup(const char *s, size_t n) {
+    size_t len = strnlen(s, n);
+    char *copy = __builtin_malloc(len + 1);
+
+    if (copy) {
+        __builtin_memcpy(copy, s, len);
+        copy[len] = 0;
+    }
+
+    return copy;
 }
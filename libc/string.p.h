@@ -0,0 +1,6 @@
+#ifndef LIBC_STRING_P_H
+#define LIBC_STRING_P_H
+
+void init_string(void);
+
+#endif // LIBC_STRING_P_H
@@ -0,0 +1,124 @@
+#include "strings.h"
+#include "compiler.h"
+#include "string.h"
+#include <emmintrin.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+// Only ASCII letters are folded; the C locale is the only one supported
+
+#define VEC_SIZE sizeof(__m128i)
+#define PAGE_SIZE 4096
+
+static unsigned char fold(unsigned char c) {
+    return (unsigned)(c - 'A') < 26 ? c | 0x20 : c;
+}
+
+// Converts the uppercase ASCII letters in v to lowercase.
+static inline __m128i fold_vec(__m128i v) {
+    // Bias the bytes so that 'A'..'Z' map to the 26 smallest signed values, which a single signed compare can pick out
+    __m128i biased = _mm_add_epi8(v, _mm_set1_epi8((char)(0x80 - 'A')));
+    __m128i upper = _mm_cmplt_epi8(biased, _mm_set1_epi8((char)(0x80 + 26)));
+    return _mm_or_si128(v, _mm_and_si128(upper, _mm_set1_epi8(0x20)));
+}
+
+// Whether an unaligned vector load from ptr could touch the next page.
+static bool crosses_page(const void *ptr) {
+    return ((uintptr_t)ptr & (PAGE_SIZE - 1)) > PAGE_SIZE - VEC_SIZE;
+}
+
+EXPORT int ffs(int i) {
+    return __builtin_ffs(i);
+}
+
+EXPORT int ffsl(long i) {
+    return __builtin_ffsl(i);
+}
+
+EXPORT int ffsll(long long i) {
+    return __builtin_ffsll(i);
+}
+
+EXPORT int strncasecmp(const char *s1, const char *s2, size_t n) {
+    const unsigned char *b1 = (const unsigned char *)s1;
+    const unsigned char *b2 = (const unsigned char *)s2;
+    __m128i zero = _mm_setzero_si128();
+
+    while (n) {
+        size_t count = n < VEC_SIZE ? n : VEC_SIZE;
+
+        if (crosses_page(b1) || crosses_page(b2)) {
+            // Fall back to comparing bytewise, since the strings might end before the page boundary
+            for (size_t i = 0; i < count; i++) {
+                unsigned char c1 = fold(b1[i]);
+                unsigned char c2 = fold(b2[i]);
+
+                if (c1 != c2) return c1 < c2 ? -1 : 1;
+                if (c1 == 0) return 0;
+            }
+        } else {
+            __m128i v1 = fold_vec(_mm_loadu_si128((const __m128i *)b1));
+            __m128i v2 = fold_vec(_mm_loadu_si128((const __m128i *)b2));
+            unsigned mask = _mm_movemask_epi8(_mm_or_si128(
+                    _mm_cmpeq_epi8(v1, zero),
+                    _mm_xor_si128(_mm_cmpeq_epi8(v1, v2), _mm_set1_epi8(-1))
+            ));
+            if (count < VEC_SIZE) mask &= (1u << count) - 1;
+
+            if (mask) {
+                size_t i = __builtin_ctz(mask);
+                unsigned char c1 = fold(b1[i]);
+                unsigned char c2 = fold(b2[i]);
+
+                if (c1 != c2) return c1 < c2 ? -1 : 1;
+                return 0;
+            }
+        }
+
+        b1 += count;
+        b2 += count;
+        n -= count;
+    }
+
+    return 0;
+}
+
+EXPORT int strcasecmp(const char *s1, const char *s2) {
+    return strncasecmp(s1, s2, SIZE_MAX);
+}
+
+EXPORT char *strcasestr(const char *s1, const char *s2) {
+    unsigned char first = fold(s2[0]);
+    if (first == 0) return (char *)s1;
+
+    size_t len = __builtin_strlen(s2);
+    const unsigned char *start = (const unsigned char *)s1;
+    const unsigned char *cur = (const unsigned char *)((uintptr_t)start & ~(VEC_SIZE - 1));
+    __m128i zero = _mm_setzero_si128();
+    __m128i needle = _mm_set1_epi8(first);
+    unsigned skip = start - cur;
+
+    // Look for candidates using the first character of s2, and only compare the whole string at those positions.
+    // Aligned loads can't cross into the next page, so they're safe to do until the terminator is found.
+    for (;;) {
+        __m128i v = _mm_load_si128((const __m128i *)cur);
+        unsigned candidates = _mm_movemask_epi8(_mm_cmpeq_epi8(fold_vec(v), needle)) >> skip << skip;
+        unsigned terminators = _mm_movemask_epi8(_mm_cmpeq_epi8(v, zero)) >> skip << skip;
+
+        if (terminators) {
+            // only candidates before the terminator are relevant
+            candidates &= (1u << __builtin_ctz(terminators)) - 1;
+        }
+
+        while (candidates) {
+            const unsigned char *pos = cur + __builtin_ctz(candidates);
+            if (strncasecmp((const char *)pos, s2, len) == 0) return (char *)pos;
+            candidates &= candidates - 1;
+        }
+
+        if (terminators) return NULL;
+
+        cur += VEC_SIZE;
+        skip = 0;
+    }
+}
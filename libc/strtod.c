@@ -0,0 +1,721 @@
+#include "stdlib.h"
+#include "compiler.h"
+#include "ctype.h"
+#include "digits.p.h"
+#include "errno.h"
+#include "strtod_tables.p.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+// Decimal to binary floating point conversion. Most inputs are handled by Clinger's fast path, which is exact when
+// both the mantissa and the power of ten are exactly representable, or by the Eisel-Lemire algorithm, which is
+// exact whenever the significant digits fit in 64 bits. Only inputs with more than 19 significant digits that are
+// too close to a rounding boundary fall back to a slow but simple arbitrary precision decimal (as in Go's strconv).
+// See "Number Parsing at a Gigabyte per Second" (Daniel Lemire, 2021) for details.
+
+typedef struct {
+    int mantissa_bits;
+    int minimum_exponent;
+    int infinite_power;
+    int smallest_power_of_ten;
+    int largest_power_of_ten;
+    int max_fast_exponent;
+    int min_round_to_even_exponent;
+    int max_round_to_even_exponent;
+} binary_format_t;
+
+static const binary_format_t double_format = {52, -1023, 0x7ff, -342, 308, 22, -4, 23};
+static const binary_format_t float_format = {23, -127, 0xff, -64, 38, 10, -17, 10};
+
+#define MAX_SIGNIFICANT_DIGITS 19
+#define MIN_19_DIGIT_INTEGER 1000000000000000000ul
+
+static const double exact_pow10[] = {
+        1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+        1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+static const float exact_pow10f[] = {1e0f, 1e1f, 1e2f, 1e3f, 1e4f, 1e5f, 1e6f, 1e7f, 1e8f, 1e9f, 1e10f};
+
+static bool is_digit(char c) {
+    return (unsigned char)(c - '0') < 10;
+}
+
+typedef enum {
+    NUMBER_DECIMAL,
+    NUMBER_HEX,
+    NUMBER_INFINITY,
+    NUMBER_NAN,
+} number_kind_t;
+
+typedef struct {
+    number_kind_t kind;
+    bool negative;
+    uint64_t mantissa; // the first 19 significant digits, or the leading bits of a hexadecimal number
+    int64_t exponent;  // the power of ten (or two, for hexadecimal numbers) the mantissa has to be multiplied with
+    bool truncated;    // whether there are nonzero digits that aren't in the mantissa
+    const char *whole;
+    size_t whole_length;
+    const char *frac;
+    size_t frac_length;
+    int64_t explicit_exponent;
+} number_t;
+
+// Returns NULL if there are no digits.
+static const char *parse_decimal(const char *str, number_t *out) {
+    uint64_t mantissa = 0;
+
+    out->whole = str;
+    str = parse_dec(str, SIZE_MAX, &mantissa);
+    out->whole_length = str - out->whole;
+
+    out->frac = str;
+    out->frac_length = 0;
+
+    if (*str == '.') {
+        out->frac = ++str;
+        str = parse_dec(str, SIZE_MAX, &mantissa);
+        out->frac_length = str - out->frac;
+    }
+
+    size_t num_digits = out->whole_length + out->frac_length;
+    if (num_digits == 0) return NULL;
+
+    out->explicit_exponent = 0;
+
+    if ((*str & ~0x20) == 'E') {
+        const char *cur = str + 1;
+        bool negative = *cur == '-';
+        if (negative || *cur == '+') cur++;
+
+        if (is_digit(*cur)) {
+            int64_t value = 0;
+
+            // anything past this is out of range anyway, so stop accumulating to avoid overflow
+            for (; is_digit(*cur); cur++) {
+                if (value < 0x10000000) value = (value * 10) + (*cur - '0');
+            }
+
+            out->explicit_exponent = negative ? -value : value;
+            str = cur;
+        }
+    }
+
+    out->mantissa = mantissa;
+    out->exponent = out->explicit_exponent - (int64_t)out->frac_length;
+    out->truncated = false;
+
+    if (num_digits > MAX_SIGNIFICANT_DIGITS) {
+        // leading zeroes aren't significant
+        for (const char *cur = out->whole; cur != out->frac + out->frac_length && (*cur == '0' || *cur == '.'); cur++) {
+            if (*cur == '0') num_digits--;
+        }
+
+        if (num_digits > MAX_SIGNIFICANT_DIGITS) {
+            // the mantissa overflowed; start over and stop after 19 significant digits
+            const char *cur = out->whole;
+            const char *end = out->whole + out->whole_length;
+            mantissa = 0;
+
+            while (mantissa < MIN_19_DIGIT_INTEGER && cur != end) {
+                mantissa = (mantissa * 10) + (*cur++ - '0');
+            }
+
+            if (mantissa >= MIN_19_DIGIT_INTEGER) {
+                out->exponent = (end - cur) + out->explicit_exponent;
+            } else {
+                cur = out->frac;
+                end = out->frac + out->frac_length;
+
+                while (mantissa < MIN_19_DIGIT_INTEGER && cur != end) {
+                    mantissa = (mantissa * 10) + (*cur++ - '0');
+                }
+
+                out->exponent = out->explicit_exponent - (cur - out->frac);
+            }
+
+            out->mantissa = mantissa;
+            out->truncated = true;
+        }
+    }
+
+    return str;
+}
+
+typedef struct {
+    uint64_t mantissa; // without the implicit bit
+    int32_t power2;    // the biased exponent
+} adjusted_mantissa_t;
+
+static bool am_equal(adjusted_mantissa_t a, adjusted_mantissa_t b) {
+    return a.mantissa == b.mantissa && a.power2 == b.power2;
+}
+
+// Returns floor(log2(10^q)) + 63.
+static int32_t power(int32_t q) {
+    return (((152170 + 65536) * q) >> 16) + 63;
+}
+
+// Eisel-Lemire: computes w * 10^q rounded to nearest, using a 128-bit approximation of 5^q. This is always exact for
+// a 64-bit w (Mushtak and Lemire, "Fast Number Parsing Without Fallback", 2023).
+static adjusted_mantissa_t compute_float(const binary_format_t *format, int64_t q, uint64_t w) {
+    adjusted_mantissa_t answer = {0, 0};
+
+    if (w == 0 || q < format->smallest_power_of_ten) return answer;
+
+    if (q > format->largest_power_of_ten) {
+        answer.power2 = format->infinite_power;
+        return answer;
+    }
+
+    int lz = __builtin_clzl(w);
+    w <<= lz;
+
+    // mantissa_bits + 3 bits are needed: the implicit bit, a bit for rounding, and a bit that might be lost to the
+    // normalization below. Only if those are all ones can the low half of the power change them.
+    const uint64_t *pow5 = POW5_128[q - POW5_128_MIN_EXPONENT];
+    const uint64_t precision_mask = UINT64_MAX >> (format->mantissa_bits + 3);
+    __uint128_t product = (__uint128_t)w * pow5[0];
+    uint64_t high = product >> 64;
+    uint64_t low = product;
+
+    if ((high & precision_mask) == precision_mask) {
+        uint64_t extra = ((__uint128_t)w * pow5[1]) >> 64;
+        low += extra;
+        if (extra > low) high++;
+    }
+
+    int upperbit = high >> 63;
+    int shift = upperbit + 64 - format->mantissa_bits - 3;
+
+    answer.mantissa = high >> shift;
+    answer.power2 = power(q) + upperbit - lz - format->minimum_exponent;
+
+    if (answer.power2 <= 0) {
+        // subnormal; if more than 64 bits would be shifted out, the result is zero
+        if (-answer.power2 + 1 >= 64) {
+            answer.mantissa = 0;
+            answer.power2 = 0;
+            return answer;
+        }
+
+        answer.mantissa >>= -answer.power2 + 1;
+        answer.mantissa += answer.mantissa & 1;
+        answer.mantissa >>= 1;
+
+        // rounding might have carried into the implicit bit, in which case the result is normal after all
+        answer.power2 = answer.mantissa < (1ul << format->mantissa_bits) ? 0 : 1;
+        return answer;
+    }
+
+    // An exact halfway case must round to even, but it can only occur when 5^q fits in 64 bits and only zeroes were
+    // shifted out of the product.
+    if (low <= 1 && q >= format->min_round_to_even_exponent && q <= format->max_round_to_even_exponent &&
+        (answer.mantissa & 3) == 1 && (answer.mantissa << shift) == high) {
+        answer.mantissa &= ~1ul;
+    }
+
+    answer.mantissa += answer.mantissa & 1;
+    answer.mantissa >>= 1;
+
+    if (answer.mantissa >= (2ul << format->mantissa_bits)) {
+        answer.mantissa = 1ul << format->mantissa_bits;
+        answer.power2++;
+    }
+
+    answer.mantissa &= ~(1ul << format->mantissa_bits);
+
+    if (answer.power2 >= format->infinite_power) {
+        answer.mantissa = 0;
+        answer.power2 = format->infinite_power;
+    }
+
+    return answer;
+}
+
+#define MAX_DECIMAL_DIGITS 800
+#define MAX_DECIMAL_SHIFT 60
+#define DECIMAL_POINT_RANGE 2047
+
+// An arbitrary precision decimal 0.d[0]d[1]... * 10^decimal_point, used when the fast paths can't decide.
+typedef struct {
+    unsigned num_digits;
+    int decimal_point;
+    bool truncated; // there are nonzero digits past the ones in the buffer
+    uint8_t digits[MAX_DECIMAL_DIGITS];
+} decimal_t;
+
+static void decimal_append(decimal_t *d, char c) {
+    if (d->num_digits < MAX_DECIMAL_DIGITS) {
+        d->digits[d->num_digits++] = c - '0';
+    } else if (c != '0') {
+        d->truncated = true;
+    }
+}
+
+static void decimal_trim(decimal_t *d) {
+    while (d->num_digits > 0 && d->digits[d->num_digits - 1] == 0) {
+        d->num_digits--;
+    }
+
+    if (d->num_digits == 0) d->decimal_point = 0;
+}
+
+static void decimal_init(decimal_t *d, const number_t *number) {
+    const char *whole = number->whole;
+    const char *whole_end = whole + number->whole_length;
+    const char *frac = number->frac;
+    const char *frac_end = frac + number->frac_length;
+
+    d->num_digits = 0;
+    d->truncated = false;
+
+    while (whole != whole_end && *whole == '0') whole++;
+
+    int64_t decimal_point = whole_end - whole;
+
+    if (whole == whole_end) {
+        while (frac != frac_end && *frac == '0') frac++;
+        decimal_point = number->frac - frac;
+    }
+
+    while (whole != whole_end) decimal_append(d, *whole++);
+    while (frac != frac_end) decimal_append(d, *frac++);
+
+    // this is just a safe bound; the conversion only cares whether the value is clearly out of range
+    decimal_point += number->explicit_exponent;
+    if (decimal_point > 100000) decimal_point = 100000;
+    else if (decimal_point < -100000) decimal_point = -100000;
+
+    d->decimal_point = decimal_point;
+    decimal_trim(d);
+}
+
+static bool decimal_prefix_less(const decimal_t *d, const char *cutoff) {
+    for (unsigned i = 0; cutoff[i] != 0; i++) {
+        if (i >= d->num_digits) return true;
+        if (d->digits[i] != cutoff[i] - '0') return d->digits[i] < cutoff[i] - '0';
+    }
+
+    return false;
+}
+
+// Multiplies by 2^shift.
+static void decimal_left_shift(decimal_t *d, unsigned shift) {
+    if (d->num_digits == 0) return;
+
+    unsigned delta = LEFT_SHIFT_CHEATS[shift].delta;
+    if (decimal_prefix_less(d, LEFT_SHIFT_CHEATS[shift].cutoff)) delta--;
+
+    int read = d->num_digits - 1;
+    unsigned write = d->num_digits + delta;
+    uint64_t n = 0;
+
+    while (read >= 0) {
+        n += (uint64_t)d->digits[read--] << shift;
+        uint64_t quotient = n / 10;
+        uint64_t remainder = n - (10 * quotient);
+
+        if (--write < MAX_DECIMAL_DIGITS) d->digits[write] = remainder;
+        else if (remainder != 0) d->truncated = true;
+
+        n = quotient;
+    }
+
+    while (n > 0) {
+        uint64_t quotient = n / 10;
+        uint64_t remainder = n - (10 * quotient);
+
+        if (--write < MAX_DECIMAL_DIGITS) d->digits[write] = remainder;
+        else if (remainder != 0) d->truncated = true;
+
+        n = quotient;
+    }
+
+    d->num_digits += delta;
+    if (d->num_digits > MAX_DECIMAL_DIGITS) d->num_digits = MAX_DECIMAL_DIGITS;
+    d->decimal_point += delta;
+    decimal_trim(d);
+}
+
+// Divides by 2^shift.
+static void decimal_right_shift(decimal_t *d, unsigned shift) {
+    unsigned read = 0;
+    unsigned write = 0;
+    uint64_t n = 0;
+
+    // pick up enough leading digits to produce the first output digit
+    while ((n >> shift) == 0) {
+        if (read < d->num_digits) {
+            n = (10 * n) + d->digits[read++];
+        } else if (n == 0) {
+            return;
+        } else {
+            while ((n >> shift) == 0) {
+                n *= 10;
+                read++;
+            }
+            break;
+        }
+    }
+
+    d->decimal_point -= read - 1;
+
+    if (d->decimal_point < -DECIMAL_POINT_RANGE) {
+        d->num_digits = 0;
+        d->decimal_point = 0;
+        d->truncated = false;
+        return;
+    }
+
+    uint64_t mask = (1ul << shift) - 1;
+
+    while (read < d->num_digits) {
+        uint8_t digit = n >> shift;
+        n = (10 * (n & mask)) + d->digits[read++];
+        d->digits[write++] = digit;
+    }
+
+    while (n > 0) {
+        uint8_t digit = n >> shift;
+        n = 10 * (n & mask);
+
+        if (write < MAX_DECIMAL_DIGITS) d->digits[write++] = digit;
+        else if (digit > 0) d->truncated = true;
+    }
+
+    d->num_digits = write;
+    decimal_trim(d);
+}
+
+// Returns the integer part, rounded to nearest with ties to even.
+static uint64_t decimal_round(const decimal_t *d) {
+    if (d->num_digits == 0 || d->decimal_point < 0) return 0;
+    if (d->decimal_point > 18) return UINT64_MAX;
+
+    unsigned point = d->decimal_point;
+    uint64_t n = 0;
+
+    for (unsigned i = 0; i < point; i++) {
+        n = (10 * n) + (i < d->num_digits ? d->digits[i] : 0);
+    }
+
+    if (point < d->num_digits) {
+        bool round_up = d->digits[point] >= 5;
+
+        if (d->digits[point] == 5 && point + 1 == d->num_digits) {
+            round_up = d->truncated || (point > 0 && (d->digits[point - 1] & 1));
+        }
+
+        if (round_up) n++;
+    }
+
+    return n;
+}
+
+static const uint8_t decimal_powers[] = {0, 3, 6, 9, 13, 16, 19, 23, 26, 29, 33, 36, 39, 43, 46, 49, 53, 56, 59};
+
+#define NUM_DECIMAL_POWERS (sizeof(decimal_powers) / sizeof(*decimal_powers))
+
+static adjusted_mantissa_t decimal_to_binary(const binary_format_t *format, decimal_t *d) {
+    adjusted_mantissa_t answer = {0, 0};
+    adjusted_mantissa_t infinity = {0, format->infinite_power};
+
+    if (d->num_digits == 0 || d->decimal_point < -324) return answer;
+    if (d->decimal_point >= 310) return infinity;
+
+    int32_t exp2 = 0;
+
+    // scale down to below 1
+    while (d->decimal_point > 0) {
+        unsigned n = d->decimal_point;
+        unsigned shift = n < NUM_DECIMAL_POWERS ? decimal_powers[n] : MAX_DECIMAL_SHIFT;
+        decimal_right_shift(d, shift);
+        if (d->num_digits == 0) return answer;
+        exp2 += shift;
+    }
+
+    // scale up to [1/2, 1)
+    while (d->decimal_point <= 0) {
+        unsigned shift;
+
+        if (d->decimal_point == 0) {
+            if (d->digits[0] >= 5) break;
+            shift = d->digits[0] < 2 ? 2 : 1;
+        } else {
+            unsigned n = -d->decimal_point;
+            shift = n < NUM_DECIMAL_POWERS ? decimal_powers[n] : MAX_DECIMAL_SHIFT;
+        }
+
+        decimal_left_shift(d, shift);
+        if (d->decimal_point > DECIMAL_POINT_RANGE) return infinity;
+        exp2 -= shift;
+    }
+
+    // the binary format uses [1, 2)
+    exp2--;
+
+    while (format->minimum_exponent + 1 > exp2) {
+        unsigned n = (format->minimum_exponent + 1) - exp2;
+        if (n > MAX_DECIMAL_SHIFT) n = MAX_DECIMAL_SHIFT;
+        decimal_right_shift(d, n);
+        exp2 += n;
+    }
+
+    if (exp2 - format->minimum_exponent >= format->infinite_power) return infinity;
+
+    decimal_left_shift(d, format->mantissa_bits + 1);
+    uint64_t mantissa = decimal_round(d);
+
+    // rounding might have overflowed into another bit
+    if (mantissa >= (2ul << format->mantissa_bits)) {
+        decimal_right_shift(d, 1);
+        exp2 += 1;
+        mantissa = decimal_round(d);
+        if (exp2 - format->minimum_exponent >= format->infinite_power) return infinity;
+    }
+
+    answer.power2 = exp2 - format->minimum_exponent;
+    if (mantissa < (1ul << format->mantissa_bits)) answer.power2--;
+    answer.mantissa = mantissa & ((1ul << format->mantissa_bits) - 1);
+    return answer;
+}
+
+// Rounds mantissa * 2^exponent to nearest, ties to even. The mantissa must be below 2^63, and sticky means there are
+// nonzero bits below it.
+static adjusted_mantissa_t binary_to_binary(const binary_format_t *format, uint64_t mantissa, int64_t exponent,
+        bool sticky) {
+    adjusted_mantissa_t answer = {0, 0};
+    if (mantissa == 0) return answer;
+
+    // normalize to [2^62, 2^63) so that the rounding bits below always fit
+    int lz = __builtin_clzl(mantissa) - 1;
+    mantissa <<= lz;
+    exponent -= lz;
+
+    // the biased exponent of the most significant bit
+    int64_t biased = exponent + 62 - format->minimum_exponent;
+
+    if (biased >= format->infinite_power) {
+        answer.power2 = format->infinite_power;
+        return answer;
+    }
+
+    unsigned shift = 62 - format->mantissa_bits;
+
+    if (biased <= 0) {
+        // below half of the smallest subnormal
+        if (shift + 1 - biased > 63) return answer;
+        shift += 1 - biased;
+        biased = 0;
+    }
+
+    uint64_t kept = mantissa >> shift;
+    uint64_t rest = mantissa & ((1ul << shift) - 1);
+    uint64_t half = 1ul << (shift - 1);
+
+    if (rest > half || (rest == half && (sticky || (kept & 1)))) kept++;
+
+    // adding the implicit bit increments the exponent, which also takes care of rounding carrying into it
+    uint64_t bits = biased ? ((uint64_t)(biased - 1) << format->mantissa_bits) + kept : kept;
+    answer.mantissa = bits & ((1ul << format->mantissa_bits) - 1);
+    answer.power2 = bits >> format->mantissa_bits;
+    return answer;
+}
+
+// Converts a finite number that can't take Clinger's fast path and returns the bits of the result without the sign.
+static uint64_t to_bits(const binary_format_t *format, const number_t *number) {
+    adjusted_mantissa_t am;
+
+    if (number->kind == NUMBER_HEX) {
+        am = binary_to_binary(format, number->mantissa, number->exponent, number->truncated);
+    } else {
+        am = compute_float(format, number->exponent, number->mantissa);
+
+        // If digits were dropped, the real value lies between w and w + 1. If both round the same way, so does it.
+        if (number->truncated && !am_equal(am, compute_float(format, number->exponent, number->mantissa + 1))) {
+            decimal_t d;
+            decimal_init(&d, number);
+            am = decimal_to_binary(format, &d);
+        }
+    }
+
+    if (am.power2 == format->infinite_power || (number->mantissa != 0 && am.power2 == 0 && am.mantissa == 0)) {
+        errno = ERANGE;
+    }
+
+    return ((uint64_t)am.power2 << format->mantissa_bits) | am.mantissa;
+}
+
+static bool is_fast_path(const binary_format_t *format, const number_t *number) {
+    return number->kind == NUMBER_DECIMAL && !number->truncated && number->exponent >= -format->max_fast_exponent &&
+           number->exponent <= format->max_fast_exponent && number->mantissa <= (2ul << format->mantissa_bits);
+}
+
+static int hex_value(char c) {
+    if (is_digit(c)) return c - '0';
+    c &= ~0x20;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// Parses the part of a hexadecimal floating point number after the 0x. Returns NULL if there are no digits.
+static const char *parse_hex(const char *str, number_t *out) {
+    uint64_t mantissa = 0;
+    int64_t exponent = 0;
+    bool sticky = false;
+    bool any = false;
+    int value;
+
+    for (; (value = hex_value(*str)) >= 0; str++) {
+        any = true;
+
+        if ((mantissa >> 59) == 0) {
+            mantissa = (mantissa << 4) | value;
+        } else {
+            exponent += 4;
+            sticky |= value != 0;
+        }
+    }
+
+    if (*str == '.') {
+        for (str++; (value = hex_value(*str)) >= 0; str++) {
+            any = true;
+
+            if ((mantissa >> 59) == 0) {
+                mantissa = (mantissa << 4) | value;
+                exponent -= 4;
+            } else {
+                sticky |= value != 0;
+            }
+        }
+    }
+
+    if (!any) return NULL;
+
+    if ((*str & ~0x20) == 'P') {
+        const char *cur = str + 1;
+        bool negative = *cur == '-';
+        if (negative || *cur == '+') cur++;
+
+        if (is_digit(*cur)) {
+            int64_t value = 0;
+
+            for (; is_digit(*cur); cur++) {
+                if (value < 0x10000000) value = (value * 10) + (*cur - '0');
+            }
+
+            exponent += negative ? -value : value;
+            str = cur;
+        }
+    }
+
+    out->mantissa = mantissa;
+    out->exponent = exponent;
+    out->truncated = sticky;
+    return str;
+}
+
+// Compares case-insensitively against a lowercase word.
+static bool match_word(const char *str, const char *word) {
+    for (; *word; str++, word++) {
+        if ((*str | 0x20) != *word) return false;
+    }
+
+    return true;
+}
+
+static const char *parse_special(const char *str, number_t *out) {
+    if (match_word(str, "inf")) {
+        out->kind = NUMBER_INFINITY;
+        return match_word(str + 3, "inity") ? str + 8 : str + 3;
+    }
+
+    if (match_word(str, "nan")) {
+        out->kind = NUMBER_NAN;
+        str += 3;
+
+        // nan(n-char-sequence)
+        if (*str == '(') {
+            const char *cur = str + 1;
+            while (isalnum(*cur) || *cur == '_') cur++;
+            if (*cur == ')') str = cur + 1;
+        }
+
+        return str;
+    }
+
+    return NULL;
+}
+
+// Returns a pointer past the number, or NULL if there is none.
+static const char *parse_number(const char *str, number_t *out) {
+    while (isspace(*str)) str++;
+
+    out->negative = str[0] == '-';
+    if (out->negative || str[0] == '+') str++;
+
+    const char *end = NULL;
+
+    out->kind = NUMBER_HEX;
+    if (str[0] == '0' && (str[1] & ~0x20) == 'X') end = parse_hex(str + 2, out);
+    if (end) return end;
+
+    out->kind = NUMBER_DECIMAL;
+    end = parse_decimal(str, out);
+    if (end) return end;
+
+    return parse_special(str, out);
+}
+
+EXPORT double strtod(const char *restrict nptr, char **restrict endptr) {
+    number_t number;
+    const char *end = parse_number(nptr, &number);
+    if (endptr) *endptr = (char *)(end ? end : nptr);
+    if (!end) return 0.0;
+
+    double value;
+
+    if (number.kind == NUMBER_INFINITY) {
+        value = __builtin_inf();
+    } else if (number.kind == NUMBER_NAN) {
+        value = __builtin_nan("");
+    } else if (is_fast_path(&double_format, &number)) {
+        // both the mantissa and the power of ten are exact, so a single rounding gives the correctly rounded result
+        value = number.mantissa;
+        value = number.exponent < 0 ? value / exact_pow10[-number.exponent] : value * exact_pow10[number.exponent];
+    } else {
+        uint64_t bits = to_bits(&double_format, &number);
+        __builtin_memcpy(&value, &bits, sizeof(value));
+    }
+
+    return number.negative ? -value : value;
+}
+
+EXPORT float strtof(const char *restrict nptr, char **restrict endptr) {
+    number_t number;
+    const char *end = parse_number(nptr, &number);
+    if (endptr) *endptr = (char *)(end ? end : nptr);
+    if (!end) return 0.0f;
+
+    float value;
+
+    if (number.kind == NUMBER_INFINITY) {
+        value = __builtin_inff();
+    } else if (number.kind == NUMBER_NAN) {
+        value = __builtin_nanf("");
+    } else if (is_fast_path(&float_format, &number)) {
+        value = number.mantissa;
+        value = number.exponent < 0 ? value / exact_pow10f[-number.exponent] : value * exact_pow10f[number.exponent];
+    } else {
+        uint32_t bits = to_bits(&float_format, &number);
+        __builtin_memcpy(&value, &bits, sizeof(value));
+    }
+
+    return number.negative ? -value : value;
+}
+
+// Like printf, this treats long double as if it were double, so the result only has double precision.
+EXPORT long double strtold(const char *restrict nptr, char **restrict endptr) {
+    return strtod(nptr, endptr);
+}
@@ -1,5 +1,6 @@
 #include "time.h"
 #include "compiler.h"
+#include "digits.p.h"
 #include "hydrogen/time.h"
 #include <stdbool.h>
 #include <stdint.h>
@@ -163,9 +164,9 @@ EXPORT char *asctime(const struct tm *timeptr) {
     // than what the tm_year field can hold.
     static char result[33];
 
-    // TODO: Change this to snprintf. It should never run out of space, but better safe than sorry
-    __builtin_sprintf(
+    __builtin_snprintf(
             result,
+            sizeof(result),
             "%.3s %.3s %.2d %.2d:%.2d:%.2d %d\n",
             wday_abbrev[timeptr->tm_wday],
             mon_abbrev[timeptr->tm_mon],
@@ -232,10 +233,17 @@ static bool add_string(char *s, size_t *offset, size_t maxsize, const char *str)
     }
 }
 
-static bool add_num(char *s, size_t *offset, size_t maxsize, int value, const char *format) {
-    char buffer[32];
-    __builtin_sprintf(buffer, format, value);
-    return add_string(s, offset, maxsize, buffer);
+// Adds a decimal number with at least min_digits digits
+static bool add_num(char *s, size_t *offset, size_t maxsize, int value, int min_digits) {
+    char buffer[16];
+    char *end = &buffer[sizeof(buffer) - 1];
+    *end = 0;
+
+    char *start = format_uint(end, value >= 0 ? (unsigned)value : -(unsigned)value, 10, false);
+    while (end - start < min_digits) *--start = '0';
+    if (value < 0) *--start = '-';
+
+    return add_string(s, offset, maxsize, start);
 }
 
 static int to_12hr(int hour) {
@@ -261,9 +269,6 @@ static int tmod(int dividend, int divisor) {
     return mod >= 0 ? mod : mod + divisor;
 }
 
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wformat-overflow"
-
 EXPORT size_t
 strftime(char *restrict s, size_t maxsize, const char *restrict format, const struct tm *restrict timeptr) {
     // TODO: Locale support
@@ -290,62 +295,58 @@ strftime(char *restrict s, size_t maxsize, const char *restrict format, const st
                 if (!add_string(s, &offset, maxsize, asctime(timeptr))) return 0;
                 break;
             case 'd':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_mday, "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_mday, 2)) return 0;
                 break;
             case 'H':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_hour, "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_hour, 2)) return 0;
                 break;
             case 'I':
-                if (!add_num(s, &offset, maxsize, to_12hr(timeptr->tm_hour), "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, to_12hr(timeptr->tm_hour), 2)) return 0;
                 break;
             case 'j':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_yday + 1, "%.3d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_yday + 1, 3)) return 0;
                 break;
             case 'm':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_mon + 1, "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_mon + 1, 2)) return 0;
                 break;
             case 'p':
                 if (!add_string(s, &offset, maxsize, timeptr->tm_hour >= 12 ? "PM" : "AM")) return 0;
                 break;
             case 'S':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_sec, "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_sec, 2)) return 0;
                 break;
             case 'U':
-                if (!add_num(s, &offset, maxsize, get_week_number(timeptr->tm_wday, timeptr->tm_yday, false), "%.2d")) {
+                if (!add_num(s, &offset, maxsize, get_week_number(timeptr->tm_wday, timeptr->tm_yday, false), 2)) {
                     return 0;
                 }
                 break;
             case 'w':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_wday, "%d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_wday, 1)) return 0;
                 break;
             case 'W':
-                if (!add_num(s, &offset, maxsize, get_week_number(timeptr->tm_wday, timeptr->tm_yday, true), "%.2d")) {
+                if (!add_num(s, &offset, maxsize, get_week_number(timeptr->tm_wday, timeptr->tm_yday, true), 2)) {
                     return 0;
                 }
                 break;
-            case 'x': {
-                char buffer[9];
-                __builtin_sprintf(
-                        buffer,
-                        "%.2d/%.2d/%.2d",
-                        timeptr->tm_mon + 1,
-                        timeptr->tm_mday,
-                        tmod(timeptr->tm_year, 100)
-                );
-                if (!add_string(s, &offset, maxsize, buffer)) return 0;
+            case 'x':
+                if (!add_num(s, &offset, maxsize, timeptr->tm_mon + 1, 2) || !add_string(s, &offset, maxsize, "/") ||
+                    !add_num(s, &offset, maxsize, timeptr->tm_mday, 2) || !add_string(s, &offset, maxsize, "/") ||
+                    !add_num(s, &offset, maxsize, tmod(timeptr->tm_year, 100), 2)) {
+                    return 0;
+                }
                 break;
-            }
-            case 'X': {
-                char buffer[9];
-                __builtin_sprintf(buffer, "%.2d:%.2d:%.2d", timeptr->tm_hour, timeptr->tm_min, timeptr->tm_sec);
-                if (!add_string(s, &offset, maxsize, buffer)) return 0;
+            case 'X':
+                if (!add_num(s, &offset, maxsize, timeptr->tm_hour, 2) || !add_string(s, &offset, maxsize, ":") ||
+                    !add_num(s, &offset, maxsize, timeptr->tm_min, 2) || !add_string(s, &offset, maxsize, ":") ||
+                    !add_num(s, &offset, maxsize, timeptr->tm_sec, 2)) {
+                    return 0;
+                }
                 break;
-            }
             case 'y':
-                if (!add_num(s, &offset, maxsize, tmod(timeptr->tm_year, 100), "%.2d")) return 0;
+                if (!add_num(s, &offset, maxsize, tmod(timeptr->tm_year, 100), 2)) return 0;
                 break;
             case 'Y':
-                if (!add_num(s, &offset, maxsize, timeptr->tm_year + 1900, "%d")) return 0;
+                if (!add_num(s, &offset, maxsize, timeptr->tm_year + 1900, 1)) return 0;
                 break;
             case 'Z':
                 if (!add_string(s, &offset, maxsize, "UTC")) return 0;
@@ -365,5 +366,3 @@ strftime(char *restrict s, size_t maxsize, const char *restrict format, const st
     s[offset] = 0;
     return offset;
 }
-
-#pragma GCC diagnostic pop
@@ -0,0 +1,410 @@
+// Throughput benchmark for the string.h and strings.h functions. Every function gets a table of GB/s by operand size
+// and alignment. Functions that stop at a match get a second table of nanoseconds per call by where the match is in a
+// 4 KiB buffer. Sizes count the bytes a call processes, not including terminators.
+//
+// Usage: bench [function...]
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+#include <time.h>
+
+#define MAX_SIZE (8ul << 20)
+#define POSITION_SIZE 4096
+
+// Operands start at these offsets from a 64-byte boundary
+#define ALIGN_SLACK 64
+#define NUM_ALIGNMENTS 5
+
+// Each sample calls the function for at least this long, and the fastest of the samples is reported
+#define SAMPLE_TIME (CLOCKS_PER_SEC / 500)
+#define NUM_SAMPLES 3
+
+typedef struct {
+    const char *name;
+    bool pair;   // the function has a source or second operand, so both alignments matter
+    bool search; // the function stops at a match, whose position the second table varies
+    // Sets up the operands for a call over size bytes whose match, if any, is at position. A position of size means
+    // there is no match.
+    void (*prepare)(size_t size, size_t position);
+    size_t (*run)(size_t size);
+} bench_t;
+
+static const size_t sizes[] = {1, 4, 8, 16, 32, 64, 128, 256, 512, 1024, 4096, 16384, 65536, 262144, 1048576, MAX_SIZE};
+static const size_t positions[] = {0, 1, 15, 16, 63, 64, 255, 1024, 4095, POSITION_SIZE};
+static const size_t single_alignments[NUM_ALIGNMENTS] = {0, 1, 7, 15, 33};
+static const size_t pair_alignments[NUM_ALIGNMENTS][2] = {{0, 0}, {1, 1}, {0, 1}, {1, 0}, {7, 13}};
+
+static unsigned char *buffer_a;
+static unsigned char *buffer_b;
+
+// The operands of the current call
+static unsigned char *a;
+static unsigned char *b;
+
+static volatile size_t sink;
+
+static void fill_string(unsigned char *s, size_t size, char c) {
+    memset(s, c, size);
+    s[size] = 0;
+}
+
+static void prepare_copy(size_t size, size_t position) {
+    (void)position;
+    fill_string(b, size, 'b');
+    a[0] = 0;
+}
+
+static void prepare_memccpy(size_t size, size_t position) {
+    fill_string(b, size, 'b');
+    if (position < size) b[position] = 'x';
+}
+
+static void prepare_scan(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    if (position < size) a[position] = 'x';
+}
+
+static void prepare_scan_reverse(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    if (position < size) a[size - 1 - position] = 'x';
+}
+
+static void prepare_strnlen(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    if (position < size) a[position] = 0;
+}
+
+static void prepare_compare(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    fill_string(b, size, 'a');
+    if (position < size) b[position] = 'b';
+}
+
+static void prepare_case_compare(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    fill_string(b, size, 'A');
+    if (position < size) b[position] = 'B';
+}
+
+static void prepare_find(size_t size, size_t position) {
+    fill_string(a, size, 'a');
+    if (position + 3 <= size) memcpy(a + position, "xyz", 3);
+    memcpy(b, "xyz", 4);
+}
+
+static void prepare_case_find(size_t size, size_t position) {
+    prepare_find(size, position);
+    memcpy(b, "XYZ", 4);
+}
+
+static size_t run_memcpy(size_t size) {
+    return (size_t)memcpy(a, b, size);
+}
+
+static size_t run_mempcpy(size_t size) {
+    return (size_t)mempcpy(a, b, size);
+}
+
+static size_t run_memmove(size_t size) {
+    return (size_t)memmove(a, b, size);
+}
+
+static size_t run_memset(size_t size) {
+    return (size_t)memset(a, 'x', size);
+}
+
+static size_t run_memccpy(size_t size) {
+    return (size_t)memccpy(a, b, 'x', size);
+}
+
+static size_t run_memcmp(size_t size) {
+    return memcmp(a, b, size);
+}
+
+static size_t run_memchr(size_t size) {
+    return (size_t)memchr(a, 'x', size);
+}
+
+static size_t run_memrchr(size_t size) {
+    return (size_t)memrchr(a, 'x', size);
+}
+
+static size_t run_strlen(size_t size) {
+    (void)size;
+    return strlen((char *)a);
+}
+
+static size_t run_strnlen(size_t size) {
+    return strnlen((char *)a, size);
+}
+
+static size_t run_strchr(size_t size) {
+    (void)size;
+    return (size_t)strchr((char *)a, 'x');
+}
+
+static size_t run_strrchr(size_t size) {
+    (void)size;
+    return (size_t)strrchr((char *)a, 'x');
+}
+
+static size_t run_strcmp(size_t size) {
+    (void)size;
+    return strcmp((char *)a, (char *)b);
+}
+
+static size_t run_strncmp(size_t size) {
+    return strncmp((char *)a, (char *)b, size);
+}
+
+static size_t run_strcasecmp(size_t size) {
+    (void)size;
+    return strcasecmp((char *)a, (char *)b);
+}
+
+static size_t run_strncasecmp(size_t size) {
+    return strncasecmp((char *)a, (char *)b, size);
+}
+
+static size_t run_strspn(size_t size) {
+    (void)size;
+    return strspn((char *)a, "abc");
+}
+
+static size_t run_strcspn(size_t size) {
+    (void)size;
+    return strcspn((char *)a, "xyz");
+}
+
+static size_t run_strpbrk(size_t size) {
+    (void)size;
+    return (size_t)strpbrk((char *)a, "xyz");
+}
+
+static size_t run_strstr(size_t size) {
+    (void)size;
+    return (size_t)strstr((char *)a, (char *)b);
+}
+
+static size_t run_strcasestr(size_t size) {
+    (void)size;
+    return (size_t)strcasestr((char *)a, (char *)b);
+}
+
+static size_t run_strcpy(size_t size) {
+    (void)size;
+    return (size_t)strcpy((char *)a, (char *)b);
+}
+
+static size_t run_stpcpy(size_t size) {
+    (void)size;
+    return (size_t)stpcpy((char *)a, (char *)b);
+}
+
+static size_t run_strncpy(size_t size) {
+    return (size_t)strncpy((char *)a, (char *)b, size);
+}
+
+static size_t run_stpncpy(size_t size) {
+    return (size_t)stpncpy((char *)a, (char *)b, size);
+}
+
+static size_t run_strlcpy(size_t size) {
+    return strlcpy((char *)a, (char *)b, size + 1);
+}
+
+static size_t run_strxfrm(size_t size) {
+    return strxfrm((char *)a, (char *)b, size + 1);
+}
+
+// The appending functions get an empty destination every time, so that they copy the same amount on every call
+static size_t run_strcat(size_t size) {
+    (void)size;
+    a[0] = 0;
+    return (size_t)strcat((char *)a, (char *)b);
+}
+
+static size_t run_strncat(size_t size) {
+    a[0] = 0;
+    return (size_t)strncat((char *)a, (char *)b, size);
+}
+
+static size_t run_strlcat(size_t size) {
+    a[0] = 0;
+    return strlcat((char *)a, (char *)b, size + 1);
+}
+
+static size_t run_strdup(size_t size) {
+    (void)size;
+    char *copy = strdup((char *)b);
+    free(copy);
+    return (size_t)copy;
+}
+
+static size_t run_strndup(size_t size) {
+    char *copy = strndup((char *)b, size);
+    free(copy);
+    return (size_t)copy;
+}
+
+static const bench_t benches[] = {
+        {"memcpy", true, false, prepare_copy, run_memcpy},
+        {"mempcpy", true, false, prepare_copy, run_mempcpy},
+        {"memmove", true, false, prepare_copy, run_memmove},
+        {"memset", false, false, prepare_copy, run_memset},
+        {"memccpy", true, true, prepare_memccpy, run_memccpy},
+        {"memcmp", true, true, prepare_compare, run_memcmp},
+        {"memchr", false, true, prepare_scan, run_memchr},
+        {"memrchr", false, true, prepare_scan_reverse, run_memrchr},
+        {"strlen", false, false, prepare_scan, run_strlen},
+        {"strnlen", false, true, prepare_strnlen, run_strnlen},
+        {"strchr", false, true, prepare_scan, run_strchr},
+        {"strrchr", false, false, prepare_scan, run_strrchr},
+        {"strcmp", true, true, prepare_compare, run_strcmp},
+        {"strncmp", true, true, prepare_compare, run_strncmp},
+        {"strcasecmp", true, true, prepare_case_compare, run_strcasecmp},
+        {"strncasecmp", true, true, prepare_case_compare, run_strncasecmp},
+        {"strspn", false, true, prepare_scan, run_strspn},
+        {"strcspn", false, true, prepare_scan, run_strcspn},
+        {"strpbrk", false, true, prepare_scan, run_strpbrk},
+        {"strstr", true, true, prepare_find, run_strstr},
+        {"strcasestr", true, true, prepare_case_find, run_strcasestr},
+        {"strcpy", true, false, prepare_copy, run_strcpy},
+        {"stpcpy", true, false, prepare_copy, run_stpcpy},
+        {"strncpy", true, false, prepare_copy, run_strncpy},
+        {"stpncpy", true, false, prepare_copy, run_stpncpy},
+        {"strlcpy", true, false, prepare_copy, run_strlcpy},
+        {"strxfrm", true, false, prepare_copy, run_strxfrm},
+        {"strcat", true, false, prepare_copy, run_strcat},
+        {"strncat", true, false, prepare_copy, run_strncat},
+        {"strlcat", true, false, prepare_copy, run_strlcat},
+        {"strdup", true, false, prepare_copy, run_strdup},
+        {"strndup", true, false, prepare_copy, run_strndup},
+};
+
+static void set_operands(const bench_t *bench, size_t column) {
+    if (bench->pair) {
+        a = buffer_a + pair_alignments[column][0];
+        b = buffer_b + pair_alignments[column][1];
+    } else {
+        a = buffer_a + single_alignments[column];
+        b = buffer_b;
+    }
+}
+
+// Returns the fastest time of a call over size bytes in nanoseconds
+static double measure(const bench_t *bench, size_t size) {
+    size_t calls = 1;
+    double best = 0;
+
+    for (int sample = 0; sample < NUM_SAMPLES;) {
+        clock_t start = clock();
+        for (size_t i = 0; i < calls; i++) {
+            sink = bench->run(size);
+        }
+        clock_t time = clock() - start;
+
+        // Keep doubling the number of calls until a sample is long enough to be timed accurately
+        if (time < SAMPLE_TIME) {
+            calls *= 2;
+            continue;
+        }
+
+        double ns = (double)time * (1000000000.0 / CLOCKS_PER_SEC) / calls;
+        if (sample == 0 || ns < best) best = ns;
+        sample++;
+    }
+
+    return best;
+}
+
+static void print_header(const bench_t *bench, const char *first) {
+    printf("%10s", first);
+
+    for (size_t column = 0; column < NUM_ALIGNMENTS; column++) {
+        if (bench->pair) {
+            // Pad the first offset so that the whole "first/second" label is right-aligned like the other columns
+            size_t second = pair_alignments[column][1];
+            int width = 9 - 1 - (second >= 10 ? 2 : 1);
+            printf("  %*lu/%lu", width, pair_alignments[column][0], second);
+        } else {
+            printf("  %9lu", single_alignments[column]);
+        }
+    }
+
+    putchar('\n');
+}
+
+static void print_sizes(const bench_t *bench) {
+    printf("\n%s: GB/s by size and alignment%s\n", bench->name, bench->pair ? " (first/second operand)" : "");
+    print_header(bench, "size");
+
+    for (size_t row = 0; row < sizeof(sizes) / sizeof(*sizes); row++) {
+        printf("%10lu", sizes[row]);
+
+        for (size_t column = 0; column < NUM_ALIGNMENTS; column++) {
+            set_operands(bench, column);
+            bench->prepare(sizes[row], sizes[row]);
+            printf("  %9.2f", sizes[row] / measure(bench, sizes[row]));
+        }
+
+        putchar('\n');
+    }
+}
+
+static void print_positions(const bench_t *bench) {
+    printf("\n%s: ns per call over %d bytes by match position and alignment\n", bench->name, POSITION_SIZE);
+    print_header(bench, "position");
+
+    for (size_t row = 0; row < sizeof(positions) / sizeof(*positions); row++) {
+        if (positions[row] < POSITION_SIZE) printf("%10lu", positions[row]);
+        else printf("%10s", "none");
+
+        for (size_t column = 0; column < NUM_ALIGNMENTS; column++) {
+            set_operands(bench, column);
+            bench->prepare(POSITION_SIZE, positions[row]);
+            printf("  %9.2f", measure(bench, POSITION_SIZE));
+        }
+
+        putchar('\n');
+    }
+}
+
+static bool selected(const char *name, int argc, char *argv[]) {
+    if (argc < 2) return true;
+
+    for (int i = 1; i < argc; i++) {
+        if (strcmp(argv[i], name) == 0) return true;
+    }
+
+    return false;
+}
+
+static unsigned char *allocate(void) {
+    unsigned char *buffer = malloc(MAX_SIZE + 2 * ALIGN_SLACK);
+    if (!buffer) {
+        printf("failed to allocate buffers\n");
+        exit(1);
+    }
+
+    return (unsigned char *)(((uintptr_t)buffer + (ALIGN_SLACK - 1)) & ~(uintptr_t)(ALIGN_SLACK - 1));
+}
+
+int main(int argc, char *argv[]) {
+    buffer_a = allocate();
+    buffer_b = allocate();
+
+    for (size_t i = 0; i < sizeof(benches) / sizeof(*benches); i++) {
+        const bench_t *bench = &benches[i];
+        if (!selected(bench->name, argc, argv)) continue;
+
+        print_sizes(bench);
+        if (bench->search) print_positions(bench);
+    }
+
+    return 0;
+}
@@ -0,0 +1,823 @@
+// Differential fuzzer for the string.h and strings.h functions. Every call is checked against the byte-at-a-time
+// versions in ref.c, with its operands placed flush against inaccessible guard pages or at random offsets, so reading
+// or writing even one byte outside an operand crashes the test.
+//
+// Usage: fuzz [seed [rounds]]
+#include "host.h"
+#include "ref.h"
+#include <hydrogen/memory.h>
+#include <stdarg.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <strings.h>
+
+#define PAGE_SIZE 4096
+#define DEFAULT_SEED 1
+#define DEFAULT_ROUNDS 20000
+#define MAX_REPORTS 8
+
+// How far around a destination stray writes are looked for, and how far from the start of a page misaligned operands
+// are placed
+#define SLACK 64
+
+// One read-write page between two inaccessible ones
+typedef struct {
+    unsigned char *start;
+    unsigned char *end;
+} region_t;
+
+static region_t region_a;
+static region_t region_b;
+static region_t region_dst;
+
+// Mirrors region_dst; the reference implementations write here
+static unsigned char expect_page[PAGE_SIZE];
+
+static char scratch[PAGE_SIZE];
+
+static uint64_t rng_state;
+static const char *current;
+static unsigned long reports;
+static unsigned long failures;
+
+static uint64_t next(void) {
+    rng_state ^= rng_state << 13;
+    rng_state ^= rng_state >> 7;
+    rng_state ^= rng_state << 17;
+    return rng_state;
+}
+
+static size_t below(size_t n) {
+    return n ? next() % n : 0;
+}
+
+static bool chance(size_t n) {
+    return below(n) == 0;
+}
+
+static void report(const char *format, ...) {
+    failures++;
+    if (reports++ >= MAX_REPORTS) return;
+
+    va_list args;
+    va_start(args, format);
+    printf("%s: ", current);
+    vprintf(format, args);
+    putchar('\n');
+    va_end(args);
+}
+
+static region_t map_region(void) {
+    intptr_t addr = hydrogen_map_memory(0, 3 * PAGE_SIZE, VMM_PRIVATE | VMM_READ | VMM_WRITE, -1, 0);
+    if (addr < 0) {
+        printf("failed to map memory\n");
+        host_exit(2);
+    }
+
+    // Remapping the outer pages without any access turns them into guard pages
+    hydrogen_map_memory(addr, PAGE_SIZE, VMM_PRIVATE | VMM_EXACT, -1, 0);
+    hydrogen_map_memory(addr + 2 * PAGE_SIZE, PAGE_SIZE, VMM_PRIVATE | VMM_EXACT, -1, 0);
+
+    return (region_t){(unsigned char *)addr + PAGE_SIZE, (unsigned char *)addr + 2 * PAGE_SIZE};
+}
+
+// Small alphabets make matches, mismatches and delimiters common. Both cases of each letter are included for the
+// case-insensitive functions, and bytes with the top bit set catch signed comparisons.
+static const char alphabet[] = "aAbBcC\x80\xff";
+
+static char random_char(void) {
+    if (chance(16)) return 1 + below(255);
+    return alphabet[below(sizeof(alphabet) - 1)];
+}
+
+static unsigned char random_byte(void) {
+    return chance(16) ? 0 : random_char();
+}
+
+// Mostly short lengths, which is where the vector code has its edge cases, but every length up to max happens
+static size_t random_length(size_t max) {
+    size_t limit;
+
+    switch (below(8)) {
+    case 0: limit = max; break;
+    case 1:
+    case 2: limit = 512; break;
+    default: limit = 64; break;
+    }
+
+    return below((limit < max ? limit : max) + 1);
+}
+
+// Places a block of the given size flush against the end of the region, misaligned near its start, or anywhere
+static unsigned char *place(const region_t *region, size_t size) {
+    size_t room = PAGE_SIZE - size;
+
+    switch (below(3)) {
+    case 0: return region->end - size;
+    case 1: return region->start + below((room < SLACK ? room : SLACK) + 1);
+    default: return region->start + below(room + 1);
+    }
+}
+
+static void fill(void *ptr, size_t size, bool string) {
+    unsigned char *p = ptr;
+
+    for (size_t i = 0; i < size; i++) {
+        p[i] = string ? (unsigned char)random_char() : random_byte();
+    }
+}
+
+static char *make_string(const region_t *region, size_t length) {
+    char *s = (char *)place(region, length + 1);
+    fill(s, length, true);
+    s[length] = 0;
+    return s;
+}
+
+// An array of n characters without a terminator, flush against the guard page. Functions that take a bound must not
+// look past it.
+static char *make_unterminated(const region_t *region, size_t n) {
+    char *s = (char *)region->end - n;
+    fill(s, n, true);
+    return s;
+}
+
+// A string in region_b that equals s, or differs from it in one place or in length
+static char *make_similar(const char *s, size_t length, bool flip_case, size_t *out_length) {
+    size_t other = chance(4) ? random_length(PAGE_SIZE - 1) : length;
+
+    for (size_t i = 0; i < other; i++) {
+        char c = i < length ? s[i] : random_char();
+        if (flip_case && ((c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z')) && chance(2)) c ^= 0x20;
+        scratch[i] = c;
+    }
+
+    if (other != 0 && chance(2)) scratch[below(other)] = random_char();
+
+    char *copy = (char *)place(&region_b, other + 1);
+    ref_memcpy(copy, scratch, other);
+    copy[other] = 0;
+
+    if (out_length) *out_length = other;
+    return copy;
+}
+
+// Only the low byte of the argument is used, so sometimes the upper bits are set too
+static int random_needle(const void *s, size_t n) {
+    int c = n != 0 && !chance(4) ? ((const unsigned char *)s)[below(n)] : random_byte();
+    if (chance(8)) c -= 256;
+    return c;
+}
+
+static long offset(const void *ptr, const void *base) {
+    return ptr ? (const unsigned char *)ptr - (const unsigned char *)base : -1;
+}
+
+static unsigned long align(const void *ptr) {
+    return (uintptr_t)ptr % SLACK;
+}
+
+static unsigned char *mirror(const void *ptr) {
+    return expect_page + ((const unsigned char *)ptr - region_dst.start);
+}
+
+// Compares the destination page with the expected one around [ptr, ptr + size), and brings it back in sync for the
+// next case
+static bool same_writes(const void *ptr, size_t size) {
+    size_t start = (const unsigned char *)ptr - region_dst.start;
+    size_t end = start + size + SLACK;
+    start = start < SLACK ? 0 : start - SLACK;
+    if (end > PAGE_SIZE) end = PAGE_SIZE;
+
+    for (size_t i = start; i < end; i++) {
+        if (region_dst.start[i] != expect_page[i]) {
+            ref_memcpy(region_dst.start + start, expect_page + start, end - start);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+// Writes the same bytes to the destination and to its mirror
+static void set_both(void *ptr, const void *src, size_t size) {
+    ref_memcpy(ptr, src, size);
+    ref_memcpy(mirror(ptr), src, size);
+}
+
+static void fuzz_memcpy(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *src = place(&region_a, n);
+    unsigned char *dst = place(&region_dst, n);
+    fill(src, n, false);
+
+    void *ret = memcpy(dst, src, n);
+    ref_memcpy(mirror(dst), src, n);
+
+    if (ret != dst || !same_writes(dst, n)) report("n=%lu dst=%lu src=%lu", n, align(dst), align(src));
+}
+
+static void fuzz_mempcpy(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *src = place(&region_a, n);
+    unsigned char *dst = place(&region_dst, n);
+    fill(src, n, false);
+
+    void *ret = mempcpy(dst, src, n);
+    ref_mempcpy(mirror(dst), src, n);
+
+    if (ret != dst + n || !same_writes(dst, n)) report("n=%lu dst=%lu src=%lu", n, align(dst), align(src));
+}
+
+static void fuzz_memmove(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *src = place(&region_dst, n);
+    unsigned char *dst = place(&region_dst, n);
+
+    // Make the operands overlap most of the time
+    if (!chance(4)) {
+        long shift = (long)below(2 * SLACK + 1) - SLACK;
+        long pos = (src - region_dst.start) + shift;
+        if (pos < 0) pos = 0;
+        if (pos > (long)(PAGE_SIZE - n)) pos = PAGE_SIZE - n;
+        dst = region_dst.start + pos;
+    }
+
+    fill(scratch, n, false);
+    set_both(src, scratch, n);
+
+    void *ret = memmove(dst, src, n);
+    ref_memmove(mirror(dst), mirror(src), n);
+
+    if (ret != dst || !same_writes(dst, n)) {
+        report("n=%lu dst=%ld src=%ld", n, offset(dst, region_dst.start), offset(src, region_dst.start));
+    }
+}
+
+static void fuzz_memset(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *dst = place(&region_dst, n);
+    int c = random_needle(NULL, 0);
+
+    void *ret = memset(dst, c, n);
+    ref_memset(mirror(dst), c, n);
+
+    if (ret != dst || !same_writes(dst, n)) report("n=%lu dst=%lu c=%d", n, align(dst), c);
+}
+
+static void fuzz_memccpy(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *src = place(&region_a, n);
+    unsigned char *dst = place(&region_dst, n);
+    fill(src, n, false);
+    int c = random_needle(src, n);
+
+    void *ret = memccpy(dst, src, c, n);
+    void *expect = ref_memccpy(mirror(dst), src, c, n);
+
+    if (offset(ret, dst) != offset(expect, mirror(dst)) || !same_writes(dst, n)) {
+        report(
+                "n=%lu dst=%lu src=%lu c=%d: got %ld, expected %ld",
+                n,
+                align(dst),
+                align(src),
+                c,
+                offset(ret, dst),
+                offset(expect, mirror(dst))
+        );
+    }
+}
+
+static void fuzz_memcmp(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *a = place(&region_a, n);
+    unsigned char *b = place(&region_b, n);
+    fill(a, n, false);
+    ref_memcpy(b, a, n);
+    if (n != 0 && !chance(4)) b[below(n)] = random_byte();
+
+    int ret = memcmp(a, b, n);
+    int expect = ref_memcmp(a, b, n);
+
+    if ((ret > 0) - (ret < 0) != expect) {
+        report("n=%lu a=%lu b=%lu: got %d, expected %d", n, align(a), align(b), ret, expect);
+    }
+}
+
+static void fuzz_memchr(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *s = place(&region_a, n);
+    fill(s, n, false);
+    int c = random_needle(s, n);
+
+    void *ret = memchr(s, c, n);
+    void *expect = ref_memchr(s, c, n);
+
+    if (ret != expect) {
+        report("n=%lu s=%lu c=%d: got %ld, expected %ld", n, align(s), c, offset(ret, s), offset(expect, s));
+    }
+}
+
+static void fuzz_memrchr(void) {
+    size_t n = random_length(PAGE_SIZE);
+    unsigned char *s = place(&region_a, n);
+    fill(s, n, false);
+    int c = random_needle(s, n);
+
+    void *ret = memrchr(s, c, n);
+    void *expect = ref_memrchr(s, c, n);
+
+    if (ret != expect) {
+        report("n=%lu s=%lu c=%d: got %ld, expected %ld", n, align(s), c, offset(ret, s), offset(expect, s));
+    }
+}
+
+static void fuzz_strlen(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *s = make_string(&region_a, length);
+
+    size_t ret = strlen(s);
+    if (ret != length) report("length=%lu s=%lu: got %lu", length, align(s), ret);
+}
+
+static void fuzz_strnlen(void) {
+    size_t n = random_length(PAGE_SIZE - 1);
+    char *s = chance(2) ? make_unterminated(&region_a, n) : make_string(&region_a, random_length(PAGE_SIZE - 1));
+
+    size_t ret = strnlen(s, n);
+    size_t expect = ref_strnlen(s, n);
+
+    if (ret != expect) report("n=%lu s=%lu: got %lu, expected %lu", n, align(s), ret, expect);
+}
+
+static void fuzz_strchr(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *s = make_string(&region_a, length);
+    int c = chance(8) ? 0 : random_needle(s, length);
+
+    char *ret = strchr(s, c);
+    char *expect = ref_strchr(s, c);
+
+    if (ret != expect) {
+        report("length=%lu s=%lu c=%d: got %ld, expected %ld", length, align(s), c, offset(ret, s), offset(expect, s));
+    }
+}
+
+static void fuzz_strrchr(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *s = make_string(&region_a, length);
+    int c = chance(8) ? 0 : random_needle(s, length);
+
+    char *ret = strrchr(s, c);
+    char *expect = ref_strrchr(s, c);
+
+    if (ret != expect) {
+        report("length=%lu s=%lu c=%d: got %ld, expected %ld", length, align(s), c, offset(ret, s), offset(expect, s));
+    }
+}
+
+static void check_compare(const char *a, const char *b, size_t n, int ret, int expect) {
+    if ((ret > 0) - (ret < 0) != expect) {
+        report(
+                "lengths=%lu,%lu n=%ld a=%lu b=%lu: got %d, expected %d",
+                ref_strlen(a),
+                ref_strlen(b),
+                (long)n,
+                align(a),
+                align(b),
+                ret,
+                expect
+        );
+    }
+}
+
+static size_t random_bound(size_t length) {
+    return chance(4) ? (size_t)-1 : below(length + 8);
+}
+
+static void fuzz_strcmp(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *a = make_string(&region_a, length);
+    char *b = make_similar(a, length, false, NULL);
+
+    check_compare(a, b, -1, strcmp(a, b), ref_strcmp(a, b));
+}
+
+static void fuzz_strncmp(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *a = make_string(&region_a, length);
+    char *b = make_similar(a, length, false, NULL);
+    size_t n = random_bound(length);
+
+    check_compare(a, b, n, strncmp(a, b, n), ref_strncmp(a, b, n));
+}
+
+static void fuzz_strcoll(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *a = make_string(&region_a, length);
+    char *b = make_similar(a, length, false, NULL);
+
+    check_compare(a, b, -1, strcoll(a, b), ref_strcmp(a, b));
+}
+
+static void fuzz_strcasecmp(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *a = make_string(&region_a, length);
+    char *b = make_similar(a, length, true, NULL);
+
+    check_compare(a, b, -1, strcasecmp(a, b), ref_strcasecmp(a, b));
+}
+
+static void fuzz_strncasecmp(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *a = make_string(&region_a, length);
+    char *b = make_similar(a, length, true, NULL);
+    size_t n = random_bound(length);
+
+    check_compare(a, b, n, strncasecmp(a, b, n), ref_strncasecmp(a, b, n));
+}
+
+static void check_span(const char *s, const char *set, size_t ret, size_t expect) {
+    if (ret != expect) {
+        report(
+                "length=%lu set=%lu s=%lu: got %lu, expected %lu",
+                ref_strlen(s),
+                ref_strlen(set),
+                align(s),
+                ret,
+                expect
+        );
+    }
+}
+
+static void fuzz_strspn(void) {
+    char *s = make_string(&region_a, random_length(PAGE_SIZE - 1));
+    char *set = make_string(&region_b, below(9));
+
+    check_span(s, set, strspn(s, set), ref_strspn(s, set));
+}
+
+static void fuzz_strcspn(void) {
+    char *s = make_string(&region_a, random_length(PAGE_SIZE - 1));
+    char *set = make_string(&region_b, below(9));
+
+    check_span(s, set, strcspn(s, set), ref_strcspn(s, set));
+}
+
+static void fuzz_strpbrk(void) {
+    char *s = make_string(&region_a, random_length(PAGE_SIZE - 1));
+    char *set = make_string(&region_b, below(9));
+
+    check_span(s, set, offset(strpbrk(s, set), s), offset(ref_strpbrk(s, set), s));
+}
+
+// A needle that is usually taken from the haystack, possibly with a changed character or flipped case
+static char *make_needle(const char *haystack, size_t length, bool flip_case) {
+    if (chance(4)) return make_string(&region_b, below(9));
+
+    size_t start = below(length + 1);
+    size_t max = length - start < 16 ? length - start : 16;
+    size_t needle_length;
+    char *needle = make_similar(haystack + start, below(max + 1), flip_case, &needle_length);
+
+    // make_similar sometimes returns a long string, which would never match
+    if (needle_length > 16) needle[below(17)] = 0;
+    return needle;
+}
+
+static void fuzz_strstr(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *s = make_string(&region_a, length);
+    char *needle = make_needle(s, length, false);
+
+    char *ret = strstr(s, needle);
+    char *expect = ref_strstr(s, needle);
+
+    if (ret != expect) {
+        report(
+                "length=%lu needle=%lu s=%lu: got %ld, expected %ld",
+                length,
+                ref_strlen(needle),
+                align(s),
+                offset(ret, s),
+                offset(expect, s)
+        );
+    }
+}
+
+static void fuzz_strcasestr(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *s = make_string(&region_a, length);
+    char *needle = make_needle(s, length, true);
+
+    char *ret = strcasestr(s, needle);
+    char *expect = ref_strcasestr(s, needle);
+
+    if (ret != expect) {
+        report(
+                "length=%lu needle=%lu s=%lu: got %ld, expected %ld",
+                length,
+                ref_strlen(needle),
+                align(s),
+                offset(ret, s),
+                offset(expect, s)
+        );
+    }
+}
+
+static void fuzz_strcpy(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+    char *dst = (char *)place(&region_dst, length + 1);
+
+    char *ret = strcpy(dst, src);
+    ref_strcpy((char *)mirror(dst), src);
+
+    if (ret != dst || !same_writes(dst, length + 1)) {
+        report("length=%lu dst=%lu src=%lu", length, align(dst), align(src));
+    }
+}
+
+static void fuzz_stpcpy(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+    char *dst = (char *)place(&region_dst, length + 1);
+
+    char *ret = stpcpy(dst, src);
+    ref_stpcpy((char *)mirror(dst), src);
+
+    if (ret != dst + length || !same_writes(dst, length + 1)) {
+        report("length=%lu dst=%lu src=%lu", length, align(dst), align(src));
+    }
+}
+
+// A source for the bounded copies: a string, or an array of n characters without a terminator
+static char *make_bounded_source(size_t n) {
+    return chance(4) ? make_unterminated(&region_a, n) : make_string(&region_a, random_length(PAGE_SIZE - 1));
+}
+
+static void fuzz_strncpy(void) {
+    size_t n = random_length(PAGE_SIZE - 1);
+    char *src = make_bounded_source(n);
+    char *dst = (char *)place(&region_dst, n);
+
+    char *ret = strncpy(dst, src, n);
+    ref_strncpy((char *)mirror(dst), src, n);
+
+    if (ret != dst || !same_writes(dst, n)) {
+        report("n=%lu length=%lu dst=%lu src=%lu", n, ref_strnlen(src, n), align(dst), align(src));
+    }
+}
+
+static void fuzz_stpncpy(void) {
+    size_t n = random_length(PAGE_SIZE - 1);
+    char *src = make_bounded_source(n);
+    char *dst = (char *)place(&region_dst, n);
+
+    char *ret = stpncpy(dst, src, n);
+    char *expect = ref_stpncpy((char *)mirror(dst), src, n);
+
+    if (offset(ret, dst) != offset(expect, mirror(dst)) || !same_writes(dst, n)) {
+        report("n=%lu length=%lu dst=%lu src=%lu", n, ref_strnlen(src, n), align(dst), align(src));
+    }
+}
+
+static void fuzz_strlcpy(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+    size_t n = random_length(PAGE_SIZE);
+    char *dst = (char *)place(&region_dst, n);
+
+    size_t ret = strlcpy(dst, src, n);
+    size_t expect = ref_strlcpy((char *)mirror(dst), src, n);
+
+    if (ret != expect || !same_writes(dst, n)) {
+        report("n=%lu length=%lu dst=%lu src=%lu", n, length, align(dst), align(src));
+    }
+}
+
+static void fuzz_strxfrm(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+    size_t n = random_length(PAGE_SIZE);
+    char *dst = (char *)place(&region_dst, n);
+
+    size_t ret = strxfrm(dst, src, n);
+    size_t expect = ref_strxfrm((char *)mirror(dst), src, n);
+
+    if (ret != expect || !same_writes(dst, n)) {
+        report("n=%lu length=%lu dst=%lu src=%lu", n, length, align(dst), align(src));
+    }
+}
+
+// Puts a string of the given length at the start of a destination block, in the page and in its mirror
+static void set_prefix(char *dst, size_t length) {
+    fill(scratch, length, true);
+    scratch[length] = 0;
+    set_both(dst, scratch, length + 1);
+}
+
+static void fuzz_strcat(void) {
+    size_t length = random_length(PAGE_SIZE / 2 - 1);
+    size_t prefix = random_length(PAGE_SIZE / 2 - 1);
+    char *src = make_string(&region_a, length);
+    char *dst = (char *)place(&region_dst, prefix + length + 1);
+    set_prefix(dst, prefix);
+
+    char *ret = strcat(dst, src);
+    ref_strcat((char *)mirror(dst), src);
+
+    if (ret != dst || !same_writes(dst, prefix + length + 1)) {
+        report("prefix=%lu length=%lu dst=%lu src=%lu", prefix, length, align(dst), align(src));
+    }
+}
+
+static void fuzz_strncat(void) {
+    size_t n = random_length(PAGE_SIZE / 2 - 1);
+    size_t prefix = random_length(PAGE_SIZE / 2 - 1);
+    char *src = make_bounded_source(n);
+    size_t length = ref_strnlen(src, n);
+    char *dst = (char *)place(&region_dst, prefix + length + 1);
+    set_prefix(dst, prefix);
+
+    char *ret = strncat(dst, src, n);
+    ref_strncat((char *)mirror(dst), src, n);
+
+    if (ret != dst || !same_writes(dst, prefix + length + 1)) {
+        report("n=%lu prefix=%lu length=%lu dst=%lu src=%lu", n, prefix, length, align(dst), align(src));
+    }
+}
+
+static void fuzz_strlcat(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+    size_t n = random_length(PAGE_SIZE);
+    size_t prefix = below(n + 8);
+    char *dst = (char *)place(&region_dst, n);
+
+    // A prefix that doesn't fit leaves the destination without a terminator, which strlcat must notice
+    fill(scratch, n, true);
+    if (prefix < n) scratch[prefix] = 0;
+    set_both(dst, scratch, n);
+
+    size_t ret = strlcat(dst, src, n);
+    size_t expect = ref_strlcat((char *)mirror(dst), src, n);
+
+    if (ret != expect || !same_writes(dst, n)) {
+        report(
+                "n=%lu prefix=%lu length=%lu dst=%lu src=%lu: got %lu, expected %lu",
+                n,
+                prefix,
+                length,
+                align(dst),
+                align(src),
+                ret,
+                expect
+        );
+    }
+}
+
+static void fuzz_strtok(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *dst = (char *)place(&region_dst, length + 1);
+    char *set = make_string(&region_b, below(4));
+    set_prefix(dst, length);
+
+    char *ret = strtok(dst, set);
+    char *expect = ref_strtok((char *)mirror(dst), set);
+
+    for (size_t token = 0;; token++) {
+        if (offset(ret, dst) != offset(expect, mirror(dst))) {
+            report(
+                    "length=%lu set=%lu token %lu: got %ld, expected %ld",
+                    length,
+                    ref_strlen(set),
+                    token,
+                    offset(ret, dst),
+                    offset(expect, mirror(dst))
+            );
+            same_writes(dst, length + 1);
+            return;
+        }
+
+        if (!ret) break;
+
+        ret = strtok(NULL, set);
+        expect = ref_strtok(NULL, set);
+    }
+
+    if (!same_writes(dst, length + 1)) report("length=%lu set=%lu: wrong contents", length, ref_strlen(set));
+}
+
+static void fuzz_strdup(void) {
+    size_t length = random_length(PAGE_SIZE - 1);
+    char *src = make_string(&region_a, length);
+
+    char *ret = strdup(src);
+    if (!ret || ref_strcmp(ret, src) != 0) report("length=%lu src=%lu", length, align(src));
+    free(ret);
+}
+
+static void fuzz_strndup(void) {
+    size_t n = random_length(PAGE_SIZE - 1);
+    char *src = make_bounded_source(n);
+    size_t length = ref_strnlen(src, n);
+
+    char *ret = strndup(src, n);
+    if (!ret || ref_strlen(ret) != length || ref_memcmp(ret, src, length) != 0) {
+        report("n=%lu length=%lu src=%lu", n, length, align(src));
+    }
+    free(ret);
+}
+
+static void fuzz_ffs(void) {
+    long long value = chance(16) ? 0 : (long long)(next() << below(64));
+
+    int ret = ffs((int)value);
+    int expect = ref_ffsll((unsigned)(int)value);
+    if (ret != expect) report("ffs(%#x): got %d, expected %d", (unsigned)(int)value, ret, expect);
+
+    ret = ffsl((long)value);
+    expect = ref_ffsll(value);
+    if (ret != expect) report("ffsl(%#lx): got %d, expected %d", (unsigned long)value, ret, expect);
+
+    ret = ffsll(value);
+    if (ret != expect) report("ffsll(%#lx): got %d, expected %d", (unsigned long)value, ret, expect);
+}
+
+static const struct {
+    const char *name;
+    void (*func)(void);
+} functions[] = {
+        {"memcpy", fuzz_memcpy},
+        {"mempcpy", fuzz_mempcpy},
+        {"memmove", fuzz_memmove},
+        {"memset", fuzz_memset},
+        {"memccpy", fuzz_memccpy},
+        {"memcmp", fuzz_memcmp},
+        {"memchr", fuzz_memchr},
+        {"memrchr", fuzz_memrchr},
+        {"strlen", fuzz_strlen},
+        {"strnlen", fuzz_strnlen},
+        {"strchr", fuzz_strchr},
+        {"strrchr", fuzz_strrchr},
+        {"strcmp", fuzz_strcmp},
+        {"strncmp", fuzz_strncmp},
+        {"strcoll", fuzz_strcoll},
+        {"strcasecmp", fuzz_strcasecmp},
+        {"strncasecmp", fuzz_strncasecmp},
+        {"strspn", fuzz_strspn},
+        {"strcspn", fuzz_strcspn},
+        {"strpbrk", fuzz_strpbrk},
+        {"strstr", fuzz_strstr},
+        {"strcasestr", fuzz_strcasestr},
+        {"strcpy", fuzz_strcpy},
+        {"stpcpy", fuzz_stpcpy},
+        {"strncpy", fuzz_strncpy},
+        {"stpncpy", fuzz_stpncpy},
+        {"strlcpy", fuzz_strlcpy},
+        {"strxfrm", fuzz_strxfrm},
+        {"strcat", fuzz_strcat},
+        {"strncat", fuzz_strncat},
+        {"strlcat", fuzz_strlcat},
+        {"strtok", fuzz_strtok},
+        {"strdup", fuzz_strdup},
+        {"strndup", fuzz_strndup},
+        {"ffs", fuzz_ffs},
+};
+
+int main(int argc, char *argv[]) {
+    unsigned long seed = argc > 1 ? strtoul(argv[1], NULL, 0) : DEFAULT_SEED;
+    unsigned long rounds = argc > 2 ? strtoul(argv[2], NULL, 0) : DEFAULT_ROUNDS;
+
+    region_a = map_region();
+    region_b = map_region();
+    region_dst = map_region();
+
+    printf("seed %lu, %lu rounds per function\n", seed, rounds);
+
+    unsigned long total = 0;
+
+    for (size_t i = 0; i < sizeof(functions) / sizeof(*functions); i++) {
+        // Each function gets its own sequence, so a failure can be reproduced without running the others first
+        rng_state = (seed + i) * 0x9e3779b97f4a7c15ul | 1;
+        current = functions[i].name;
+        reports = 0;
+        failures = 0;
+
+        for (unsigned long round = 0; round < rounds; round++) {
+            functions[i].func();
+        }
+
+        if (failures) printf("%-12s %lu of %lu cases failed\n", current, failures, rounds);
+        else printf("%-12s ok\n", current);
+
+        total += failures;
+    }
+
+    host_exit(total != 0);
+}
@@ -0,0 +1,8 @@
+#ifndef HOST_H
+#define HOST_H
+
+// libc's exit can't report a status on Linux, because hydrogen_exit doesn't take one. This flushes all streams and
+// exits with the given status instead.
+_Noreturn void host_exit(int status);
+
+#endif // HOST_H
@@ -0,0 +1,24 @@
+#ifndef HYDROGEN_ERROR_H
+#define HYDROGEN_ERROR_H 1
+
+#define ERR_ACCESS_DENIED 1
+#define ERR_INVALID_HANDLE 2
+#define ERR_BUSY 3
+#define ERR_ALREADY_EXISTS 4
+#define ERR_INVALID_POINTER 5
+#define ERR_INVALID_ARGUMENT 6
+#define ERR_IS_A_DIRECTORY 7
+#define ERR_TOO_MANY_SYMLINKS 8
+#define ERR_NO_MORE_HANDLES 9
+#define ERR_NAME_TOO_LONG 10
+#define ERR_NOT_FOUND 11
+#define ERR_INVALID_IMAGE 12
+#define ERR_OUT_OF_MEMORY 13
+#define ERR_DISK_FULL 14
+#define ERR_NOT_IMPLEMENTED 15
+#define ERR_NOT_A_DIRECTORY 16
+#define ERR_NOT_EMPTY 17
+#define ERR_OVERFLOW 18
+#define ERR_DIFFERENT_FILESYSTEMS 19
+
+#endif /* HYDROGEN_ERROR_H */
@@ -0,0 +1,17 @@
+#ifndef HYDROGEN_FCNTL_H
+#define HYDROGEN_FCNTL_H 1
+
+#include <hydrogen/types.h>
+
+#define O_RDONLY 1
+#define O_WRONLY 2
+#define O_CREAT 4
+#define O_TRUNC 8
+#define O_APPEND 16
+#define O_EXCL 32
+#define O_NODIR 64
+
+int hydrogen_open(int rel, const void *path, size_t length, int flags, uint32_t mode);
+int hydrogen_close(int fd);
+
+#endif /* HYDROGEN_FCNTL_H */
@@ -0,0 +1,16 @@
+#ifndef HYDROGEN_MEMORY_H
+#define HYDROGEN_MEMORY_H 1
+
+#include <hydrogen/types.h>
+
+#define VMM_READ 1
+#define VMM_WRITE 2
+#define VMM_EXEC 4
+#define VMM_PRIVATE 8
+#define VMM_EXACT 16
+#define VMM_TRY_EXACT 32
+
+intptr_t hydrogen_map_memory(uintptr_t addr, size_t size, int flags, int fd, uint64_t offset);
+int hydrogen_unmap_memory(uintptr_t addr, size_t size);
+
+#endif /* HYDROGEN_MEMORY_H */
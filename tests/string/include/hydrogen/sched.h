@@ -0,0 +1,6 @@
+#ifndef HYDROGEN_SCHED_H
+#define HYDROGEN_SCHED_H 1
+
+_Noreturn void hydrogen_exit(void);
+
+#endif /* HYDROGEN_SCHED_H */
@@ -0,0 +1,9 @@
+#ifndef HYDROGEN_TIME_H
+#define HYDROGEN_TIME_H 1
+
+#include <stdint.h>
+
+uint64_t hydrogen_get_ns_since_boot(void);
+__int128_t hydrogen_get_ns_since_epoch_utc(void);
+
+#endif /* HYDROGEN_TIME_H */
@@ -0,0 +1,25 @@
+#ifndef HYDROGEN_TYPES_H
+#define HYDROGEN_TYPES_H 1
+
+/* Host stand-ins for the Hydrogen API headers, covering only what libc uses. They are implemented by ../../shim.c. */
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+typedef struct {
+    size_t transferred;
+    int error;
+} hydrogen_io_res_t;
+
+typedef enum {
+    HYDROGEN_WHENCE_SET,
+    HYDROGEN_WHENCE_CUR,
+    HYDROGEN_WHENCE_END,
+} hydrogen_whence_t;
+
+typedef struct {
+    uint64_t size;
+} hydrogen_stat_t;
+
+#endif /* HYDROGEN_TYPES_H */
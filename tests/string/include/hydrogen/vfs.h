@@ -0,0 +1,13 @@
+#ifndef HYDROGEN_VFS_H
+#define HYDROGEN_VFS_H 1
+
+#include <hydrogen/types.h>
+
+hydrogen_io_res_t hydrogen_read(int fd, void *buffer, size_t size);
+hydrogen_io_res_t hydrogen_write(int fd, const void *buffer, size_t size);
+int hydrogen_seek(int fd, uint64_t *offset, hydrogen_whence_t whence);
+int hydrogen_unlink(int rel, const void *path, size_t length, bool dir);
+int hydrogen_rename(int rel, const void *path, size_t length, int new_rel, const void *new_path, size_t new_length);
+int hydrogen_stat(int rel, const void *path, size_t length, hydrogen_stat_t *out, bool follow);
+
+#endif /* HYDROGEN_VFS_H */
@@ -0,0 +1,277 @@
+#include "ref.h"
+#include <stdbool.h>
+#include <stddef.h>
+
+static int sign(int value) {
+    return (value > 0) - (value < 0);
+}
+
+static unsigned char fold(unsigned char c) {
+    return c >= 'A' && c <= 'Z' ? c - 'A' + 'a' : c;
+}
+
+void *ref_memcpy(void *restrict s1, const void *restrict s2, size_t n) {
+    unsigned char *d = s1;
+    const unsigned char *s = s2;
+
+    for (size_t i = 0; i < n; i++) {
+        d[i] = s[i];
+    }
+
+    return s1;
+}
+
+void *ref_mempcpy(void *restrict s1, const void *restrict s2, size_t n) {
+    return (unsigned char *)ref_memcpy(s1, s2, n) + n;
+}
+
+void *ref_memmove(void *s1, const void *s2, size_t n) {
+    unsigned char *d = s1;
+    const unsigned char *s = s2;
+
+    if (d < s) {
+        for (size_t i = 0; i < n; i++) {
+            d[i] = s[i];
+        }
+    } else {
+        for (size_t i = n; i > 0; i--) {
+            d[i - 1] = s[i - 1];
+        }
+    }
+
+    return s1;
+}
+
+void *ref_memccpy(void *restrict s1, const void *restrict s2, int c, size_t n) {
+    unsigned char *d = s1;
+    const unsigned char *s = s2;
+
+    for (size_t i = 0; i < n; i++) {
+        d[i] = s[i];
+        if (s[i] == (unsigned char)c) return d + i + 1;
+    }
+
+    return NULL;
+}
+
+void *ref_memset(void *s, int c, size_t n) {
+    unsigned char *d = s;
+
+    for (size_t i = 0; i < n; i++) {
+        d[i] = c;
+    }
+
+    return s;
+}
+
+int ref_memcmp(const void *s1, const void *s2, size_t n) {
+    const unsigned char *a = s1;
+    const unsigned char *b = s2;
+
+    for (size_t i = 0; i < n; i++) {
+        if (a[i] != b[i]) return sign(a[i] - b[i]);
+    }
+
+    return 0;
+}
+
+void *ref_memchr(const void *s, int c, size_t n) {
+    const unsigned char *p = s;
+
+    for (size_t i = 0; i < n; i++) {
+        if (p[i] == (unsigned char)c) return (void *)(p + i);
+    }
+
+    return NULL;
+}
+
+void *ref_memrchr(const void *s, int c, size_t n) {
+    const unsigned char *p = s;
+
+    for (size_t i = n; i > 0; i--) {
+        if (p[i - 1] == (unsigned char)c) return (void *)(p + i - 1);
+    }
+
+    return NULL;
+}
+
+size_t ref_strlen(const char *s) {
+    size_t len = 0;
+    while (s[len]) len++;
+    return len;
+}
+
+size_t ref_strnlen(const char *s, size_t n) {
+    size_t len = 0;
+    while (len < n && s[len]) len++;
+    return len;
+}
+
+char *ref_strcpy(char *restrict s1, const char *restrict s2) {
+    ref_stpcpy(s1, s2);
+    return s1;
+}
+
+char *ref_stpcpy(char *restrict s1, const char *restrict s2) {
+    size_t len = ref_strlen(s2);
+    ref_memcpy(s1, s2, len + 1);
+    return s1 + len;
+}
+
+char *ref_strncpy(char *restrict s1, const char *restrict s2, size_t n) {
+    ref_stpncpy(s1, s2, n);
+    return s1;
+}
+
+char *ref_stpncpy(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = ref_strnlen(s2, n);
+    ref_memcpy(s1, s2, len);
+    ref_memset(s1 + len, 0, n - len);
+    return s1 + len;
+}
+
+size_t ref_strlcpy(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = ref_strlen(s2);
+
+    if (n != 0) {
+        size_t copy = len < n - 1 ? len : n - 1;
+        ref_memcpy(s1, s2, copy);
+        s1[copy] = 0;
+    }
+
+    return len;
+}
+
+char *ref_strcat(char *restrict s1, const char *restrict s2) {
+    ref_strcpy(s1 + ref_strlen(s1), s2);
+    return s1;
+}
+
+char *ref_strncat(char *restrict s1, const char *restrict s2, size_t n) {
+    char *d = s1 + ref_strlen(s1);
+    size_t len = ref_strnlen(s2, n);
+
+    ref_memcpy(d, s2, len);
+    d[len] = 0;
+    return s1;
+}
+
+size_t ref_strlcat(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = ref_strnlen(s1, n);
+    if (len == n) return n + ref_strlen(s2);
+    return len + ref_strlcpy(s1 + len, s2, n - len);
+}
+
+// In the C locale this copies the string unchanged, stopping once n bytes have been written
+size_t ref_strxfrm(char *restrict s1, const char *restrict s2, size_t n) {
+    size_t len = ref_strlen(s2);
+    ref_memcpy(s1, s2, len + 1 < n ? len + 1 : n);
+    return len;
+}
+
+int ref_strcmp(const char *s1, const char *s2) {
+    return ref_strncmp(s1, s2, (size_t)-1);
+}
+
+int ref_strncmp(const char *s1, const char *s2, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        unsigned char a = s1[i];
+        unsigned char b = s2[i];
+
+        if (a != b) return sign(a - b);
+        if (a == 0) break;
+    }
+
+    return 0;
+}
+
+int ref_strcasecmp(const char *s1, const char *s2) {
+    return ref_strncasecmp(s1, s2, (size_t)-1);
+}
+
+int ref_strncasecmp(const char *s1, const char *s2, size_t n) {
+    for (size_t i = 0; i < n; i++) {
+        unsigned char a = fold(s1[i]);
+        unsigned char b = fold(s2[i]);
+
+        if (a != b) return sign(a - b);
+        if (a == 0) break;
+    }
+
+    return 0;
+}
+
+char *ref_strchr(const char *s, int c) {
+    return ref_memchr(s, c, ref_strlen(s) + 1);
+}
+
+char *ref_strrchr(const char *s, int c) {
+    return ref_memrchr(s, c, ref_strlen(s) + 1);
+}
+
+static bool in_set(const char *set, char c) {
+    for (size_t i = 0; set[i]; i++) {
+        if (set[i] == c) return true;
+    }
+
+    return false;
+}
+
+size_t ref_strspn(const char *s1, const char *s2) {
+    size_t len = 0;
+    while (s1[len] && in_set(s2, s1[len])) len++;
+    return len;
+}
+
+size_t ref_strcspn(const char *s1, const char *s2) {
+    size_t len = 0;
+    while (s1[len] && !in_set(s2, s1[len])) len++;
+    return len;
+}
+
+char *ref_strpbrk(const char *s1, const char *s2) {
+    size_t len = ref_strcspn(s1, s2);
+    return s1[len] ? (char *)s1 + len : NULL;
+}
+
+static char *find(const char *s1, const char *s2, bool ignore_case) {
+    size_t len = ref_strlen(s2);
+
+    for (const char *cur = s1;; cur++) {
+        if ((ignore_case ? ref_strncasecmp(cur, s2, len) : ref_strncmp(cur, s2, len)) == 0) return (char *)cur;
+        if (!*cur) return NULL;
+    }
+}
+
+char *ref_strstr(const char *s1, const char *s2) {
+    return find(s1, s2, false);
+}
+
+char *ref_strcasestr(const char *s1, const char *s2) {
+    return find(s1, s2, true);
+}
+
+char *ref_strtok(char *restrict s1, const char *restrict s2) {
+    static char *state;
+    char *cur = s1 ? s1 : state;
+
+    cur += ref_strspn(cur, s2);
+    if (!*cur) {
+        state = cur;
+        return NULL;
+    }
+
+    char *end = cur + ref_strcspn(cur, s2);
+    if (*end) *end++ = 0;
+
+    state = end;
+    return cur;
+}
+
+int ref_ffsll(long long i) {
+    for (int bit = 0; bit < 64; bit++) {
+        if ((unsigned long long)i & (1ull << bit)) return bit + 1;
+    }
+
+    return 0;
+}
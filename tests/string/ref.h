@@ -0,0 +1,43 @@
+#ifndef REF_H
+#define REF_H
+
+#include <stddef.h>
+
+// Byte-at-a-time versions of the string.h and strings.h functions, written for obviousness rather than speed. The
+// fuzzer compares libc against these. Comparison functions return -1, 0 or 1.
+
+void *ref_memcpy(void *restrict s1, const void *restrict s2, size_t n);
+void *ref_mempcpy(void *restrict s1, const void *restrict s2, size_t n);
+void *ref_memmove(void *s1, const void *s2, size_t n);
+void *ref_memccpy(void *restrict s1, const void *restrict s2, int c, size_t n);
+void *ref_memset(void *s, int c, size_t n);
+int ref_memcmp(const void *s1, const void *s2, size_t n);
+void *ref_memchr(const void *s, int c, size_t n);
+void *ref_memrchr(const void *s, int c, size_t n);
+
+size_t ref_strlen(const char *s);
+size_t ref_strnlen(const char *s, size_t n);
+char *ref_strcpy(char *restrict s1, const char *restrict s2);
+char *ref_stpcpy(char *restrict s1, const char *restrict s2);
+char *ref_strncpy(char *restrict s1, const char *restrict s2, size_t n);
+char *ref_stpncpy(char *restrict s1, const char *restrict s2, size_t n);
+size_t ref_strlcpy(char *restrict s1, const char *restrict s2, size_t n);
+char *ref_strcat(char *restrict s1, const char *restrict s2);
+char *ref_strncat(char *restrict s1, const char *restrict s2, size_t n);
+size_t ref_strlcat(char *restrict s1, const char *restrict s2, size_t n);
+size_t ref_strxfrm(char *restrict s1, const char *restrict s2, size_t n);
+int ref_strcmp(const char *s1, const char *s2);
+int ref_strncmp(const char *s1, const char *s2, size_t n);
+int ref_strcasecmp(const char *s1, const char *s2);
+int ref_strncasecmp(const char *s1, const char *s2, size_t n);
+char *ref_strchr(const char *s, int c);
+char *ref_strrchr(const char *s, int c);
+size_t ref_strspn(const char *s1, const char *s2);
+size_t ref_strcspn(const char *s1, const char *s2);
+char *ref_strpbrk(const char *s1, const char *s2);
+char *ref_strstr(const char *s1, const char *s2);
+char *ref_strcasestr(const char *s1, const char *s2);
+char *ref_strtok(char *restrict s1, const char *restrict s2);
+int ref_ffsll(long long i);
+
+#endif // REF_H
@@ -0,0 +1,262 @@
+// Implements the parts of the Hydrogen API that libc uses on top of Linux system calls, so that libc can be linked into
+// ordinary Linux executables. Paths are always resolved relative to the working directory, because libc never passes
+// anything but -1 as the base directory handle.
+#include "host.h"
+#include <hydrogen/error.h>
+#include <hydrogen/fcntl.h>
+#include <hydrogen/memory.h>
+#include <hydrogen/sched.h>
+#include <hydrogen/time.h>
+#include <hydrogen/types.h>
+#include <hydrogen/vfs.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#define SYS_READ 0
+#define SYS_WRITE 1
+#define SYS_OPEN 2
+#define SYS_CLOSE 3
+#define SYS_STAT 4
+#define SYS_LSTAT 6
+#define SYS_LSEEK 8
+#define SYS_MMAP 9
+#define SYS_MUNMAP 11
+#define SYS_RENAME 82
+#define SYS_RMDIR 84
+#define SYS_UNLINK 87
+#define SYS_CLOCK_GETTIME 228
+#define SYS_EXIT_GROUP 231
+
+#define LINUX_O_WRONLY 01
+#define LINUX_O_RDWR 02
+#define LINUX_O_CREAT 0100
+#define LINUX_O_EXCL 0200
+#define LINUX_O_TRUNC 01000
+#define LINUX_O_APPEND 02000
+
+#define LINUX_PROT_READ 1
+#define LINUX_PROT_WRITE 2
+#define LINUX_PROT_EXEC 4
+#define LINUX_MAP_SHARED 1
+#define LINUX_MAP_PRIVATE 2
+#define LINUX_MAP_FIXED 0x10
+#define LINUX_MAP_ANONYMOUS 0x20
+#define LINUX_MAP_FIXED_NOREPLACE 0x100000
+
+#define LINUX_CLOCK_REALTIME 0
+#define LINUX_CLOCK_MONOTONIC 1
+
+#define PATH_SIZE 4096
+
+struct linux_timespec {
+    long sec;
+    long nsec;
+};
+
+// Only the leading fields of the x86_64 struct stat are needed
+struct linux_stat {
+    unsigned long dev;
+    unsigned long ino;
+    unsigned long nlink;
+    unsigned mode;
+    unsigned uid;
+    unsigned gid;
+    unsigned pad;
+    unsigned long rdev;
+    long size;
+    long rest[12];
+};
+
+static long syscall6(long num, long a0, long a1, long a2, long a3, long a4, long a5) {
+    register long r10 asm("r10") = a3;
+    register long r8 asm("r8") = a4;
+    register long r9 asm("r9") = a5;
+    long ret;
+
+    asm volatile("syscall"
+                 : "=a"(ret)
+                 : "a"(num), "D"(a0), "S"(a1), "d"(a2), "r"(r10), "r"(r8), "r"(r9)
+                 : "rcx", "r11", "memory");
+    return ret;
+}
+
+static long syscall3(long num, long a0, long a1, long a2) {
+    return syscall6(num, a0, a1, a2, 0, 0, 0);
+}
+
+static int map_error(long error) {
+    switch (error) {
+    case 1:
+    case 13: return ERR_ACCESS_DENIED;
+    case 2: return ERR_NOT_FOUND;
+    case 9: return ERR_INVALID_HANDLE;
+    case 12: return ERR_OUT_OF_MEMORY;
+    case 14: return ERR_INVALID_POINTER;
+    case 16: return ERR_BUSY;
+    case 17: return ERR_ALREADY_EXISTS;
+    case 18: return ERR_DIFFERENT_FILESYSTEMS;
+    case 20: return ERR_NOT_A_DIRECTORY;
+    case 21: return ERR_IS_A_DIRECTORY;
+    case 24: return ERR_NO_MORE_HANDLES;
+    case 28: return ERR_DISK_FULL;
+    case 36: return ERR_NAME_TOO_LONG;
+    case 38: return ERR_NOT_IMPLEMENTED;
+    case 39: return ERR_NOT_EMPTY;
+    case 40: return ERR_TOO_MANY_SYMLINKS;
+    case 75: return ERR_OVERFLOW;
+    default: return ERR_INVALID_ARGUMENT;
+    }
+}
+
+// Turns a negative Linux return value into a positive Hydrogen error, and anything else into 0
+static int to_error(long ret) {
+    return ret < 0 ? map_error(-ret) : 0;
+}
+
+static hydrogen_io_res_t to_io_res(long ret) {
+    if (ret < 0) return (hydrogen_io_res_t){0, map_error(-ret)};
+    return (hydrogen_io_res_t){ret, 0};
+}
+
+// Hydrogen paths are counted, Linux paths are terminated
+static bool copy_path(char *buffer, const void *path, size_t length) {
+    if (length >= PATH_SIZE) return false;
+
+    for (size_t i = 0; i < length; i++) {
+        buffer[i] = ((const char *)path)[i];
+    }
+
+    buffer[length] = 0;
+    return true;
+}
+
+int hydrogen_open(int rel, const void *path, size_t length, int flags, uint32_t mode) {
+    (void)rel;
+
+    char buffer[PATH_SIZE];
+    if (!copy_path(buffer, path, length)) return -ERR_NAME_TOO_LONG;
+
+    // O_NODIR has no Linux equivalent; reading a directory descriptor fails later with ERR_IS_A_DIRECTORY instead
+    int linux_flags = 0;
+    if ((flags & (O_RDONLY | O_WRONLY)) == (O_RDONLY | O_WRONLY)) linux_flags = LINUX_O_RDWR;
+    else if (flags & O_WRONLY) linux_flags = LINUX_O_WRONLY;
+    if (flags & O_CREAT) linux_flags |= LINUX_O_CREAT;
+    if (flags & O_EXCL) linux_flags |= LINUX_O_EXCL;
+    if (flags & O_TRUNC) linux_flags |= LINUX_O_TRUNC;
+    if (flags & O_APPEND) linux_flags |= LINUX_O_APPEND;
+
+    long ret = syscall3(SYS_OPEN, (long)buffer, linux_flags, mode);
+    return ret < 0 ? -map_error(-ret) : ret;
+}
+
+int hydrogen_close(int fd) {
+    return to_error(syscall3(SYS_CLOSE, fd, 0, 0));
+}
+
+hydrogen_io_res_t hydrogen_read(int fd, void *buffer, size_t size) {
+    return to_io_res(syscall3(SYS_READ, fd, (long)buffer, size));
+}
+
+hydrogen_io_res_t hydrogen_write(int fd, const void *buffer, size_t size) {
+    return to_io_res(syscall3(SYS_WRITE, fd, (long)buffer, size));
+}
+
+int hydrogen_seek(int fd, uint64_t *offset, hydrogen_whence_t whence) {
+    long ret = syscall3(SYS_LSEEK, fd, *offset, whence);
+    if (ret < 0) return map_error(-ret);
+
+    *offset = ret;
+    return 0;
+}
+
+int hydrogen_unlink(int rel, const void *path, size_t length, bool dir) {
+    (void)rel;
+
+    char buffer[PATH_SIZE];
+    if (!copy_path(buffer, path, length)) return ERR_NAME_TOO_LONG;
+
+    return to_error(syscall3(dir ? SYS_RMDIR : SYS_UNLINK, (long)buffer, 0, 0));
+}
+
+int hydrogen_rename(int rel, const void *path, size_t length, int new_rel, const void *new_path, size_t new_length) {
+    (void)rel;
+    (void)new_rel;
+
+    char buffer[PATH_SIZE], new_buffer[PATH_SIZE];
+    if (!copy_path(buffer, path, length) || !copy_path(new_buffer, new_path, new_length)) return ERR_NAME_TOO_LONG;
+
+    return to_error(syscall3(SYS_RENAME, (long)buffer, (long)new_buffer, 0));
+}
+
+int hydrogen_stat(int rel, const void *path, size_t length, hydrogen_stat_t *out, bool follow) {
+    (void)rel;
+
+    char buffer[PATH_SIZE];
+    if (!copy_path(buffer, path, length)) return ERR_NAME_TOO_LONG;
+
+    struct linux_stat st;
+    long ret = syscall3(follow ? SYS_STAT : SYS_LSTAT, (long)buffer, (long)&st, 0);
+    if (ret < 0) return map_error(-ret);
+
+    out->size = st.size;
+    return 0;
+}
+
+// Anything that isn't a descriptor gets anonymous memory; libc passes both 0 and -1 for that. Mappings without any
+// access flags are inaccessible, which the fuzzer relies on for its guard pages.
+intptr_t hydrogen_map_memory(uintptr_t addr, size_t size, int flags, int fd, uint64_t offset) {
+    int prot = 0;
+    if (flags & (VMM_READ | VMM_WRITE | VMM_EXEC)) prot |= LINUX_PROT_READ;
+    if (flags & VMM_WRITE) prot |= LINUX_PROT_WRITE;
+    if (flags & VMM_EXEC) prot |= LINUX_PROT_EXEC;
+
+    int linux_flags = (flags & VMM_PRIVATE) ? LINUX_MAP_PRIVATE : LINUX_MAP_SHARED;
+    if (fd <= 0) {
+        linux_flags |= LINUX_MAP_ANONYMOUS;
+        fd = -1;
+    }
+    if (flags & VMM_EXACT) linux_flags |= LINUX_MAP_FIXED;
+    else if (flags & VMM_TRY_EXACT) linux_flags |= LINUX_MAP_FIXED_NOREPLACE;
+
+    long ret = syscall6(SYS_MMAP, addr, size, prot, linux_flags, fd, offset);
+    return ret < 0 ? -map_error(-ret) : ret;
+}
+
+int hydrogen_unmap_memory(uintptr_t addr, size_t size) {
+    return to_error(syscall3(SYS_MUNMAP, addr, size, 0));
+}
+
+_Noreturn void hydrogen_exit(void) {
+    for (;;) {
+        syscall3(SYS_EXIT_GROUP, 0, 0, 0);
+    }
+}
+
+_Noreturn void host_exit(int status) {
+    fflush(NULL);
+
+    for (;;) {
+        syscall3(SYS_EXIT_GROUP, status, 0, 0);
+    }
+}
+
+uint64_t hydrogen_get_ns_since_boot(void) {
+    struct linux_timespec ts;
+    syscall3(SYS_CLOCK_GETTIME, LINUX_CLOCK_MONOTONIC, (long)&ts, 0);
+    return ts.sec * 1000000000ul + ts.nsec;
+}
+
+__int128_t hydrogen_get_ns_since_epoch_utc(void) {
+    struct linux_timespec ts;
+    syscall3(SYS_CLOCK_GETTIME, LINUX_CLOCK_REALTIME, (long)&ts, 0);
+    return (__int128_t)ts.sec * 1000000000 + ts.nsec;
+}
+
+// crt0 passes these to __libc_start; the host executables have no init or fini sections
+void _init(void) {
+}
+
+void _fini(void) {
+}
@@ -0,0 +1,85 @@
+// Checks the shortest round-trip output of dtochars and ftochars against known strings.
+#include "host.h"
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef struct {
+    double value;
+    const char *expected;
+} double_case_t;
+
+typedef struct {
+    float value;
+    const char *expected;
+} float_case_t;
+
+static const double_case_t double_cases[] = {
+        {0.0, "0"},
+        {1.0, "1"},
+        {7.0, "7"},
+        {12.0, "12"},
+        {42.0, "42"},
+        {123456.0, "123456"},
+        {9007199254740992.0, "9007199254740992"},
+        {1e4, "10000"},
+        {1e5, "1e+05"},
+        {-1.0, "-1"},
+        {1.5, "1.5"},
+        {0.25, "0.25"},
+        {123.456, "123.456"},
+        {1e-7, "1e-07"},
+        {1e100, "1e+100"},
+};
+
+static const float_case_t float_cases[] = {
+        {0.0f, "0"},
+        {1.0f, "1"},
+        {7.0f, "7"},
+        {12.0f, "12"},
+        {42.0f, "42"},
+        {123456.0f, "123456"},
+        {16777216.0f, "16777216"},
+        {1e4f, "10000"},
+        {1e5f, "1e+05"},
+        {-1.0f, "-1"},
+        {1.5f, "1.5"},
+        {0.25f, "0.25"},
+};
+
+static unsigned long failures;
+
+static void check(const char *name, char *buffer, char *end, const char *expected) {
+    if (!end) {
+        printf("%s: expected \"%s\", got an error\n", name, expected);
+        failures++;
+        return;
+    }
+
+    *end = 0;
+
+    if (strcmp(buffer, expected)) {
+        printf("%s: expected \"%s\", got \"%s\"\n", name, expected, buffer);
+        failures++;
+    }
+}
+
+int main(void) {
+    char buffer[64];
+
+    for (size_t i = 0; i < sizeof(double_cases) / sizeof(*double_cases); i++) {
+        char *end = dtochars(buffer, buffer + sizeof(buffer) - 1, double_cases[i].value);
+        check("dtochars", buffer, end, double_cases[i].expected);
+    }
+
+    for (size_t i = 0; i < sizeof(float_cases) / sizeof(*float_cases); i++) {
+        char *end = ftochars(buffer, buffer + sizeof(buffer) - 1, float_cases[i].value);
+        check("ftochars", buffer, end, float_cases[i].expected);
+    }
+
+    if (failures) printf("%lu cases failed\n", failures);
+    else printf("ok\n");
+
+    host_exit(failures != 0);
+}